@@ -0,0 +1,649 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "stdafx.h"
+
+#ifdef _WIN32
+#include <psapi.h>
+#else
+// For converting from ANSI to UTF16
+#include <src/include/pal/utils.h>
+#endif
+
+// GCBench: deterministic Recycler microbenchmarks.
+//
+// Unlike GCStress, which performs random heap mutations to validate correctness, every
+// scenario here runs a fixed allocation pattern (seeded rand) so runs are comparable across
+// builds. For each scenario we report allocation throughput, pause percentiles, total mark and
+// sweep time and resident set size.
+
+void DoVerify(bool value, const char * expr, const char * file, int line)
+{
+    if (!value)
+    {
+        wprintf(_u("==== FAILURE: '%S' evaluated to false. %S(%d)\n"), expr, file, line);
+        DebugBreak();
+    }
+}
+
+// Recycler instance
+Recycler * recyclerInstance = nullptr;
+
+static unsigned int scale = 1;
+static unsigned int seed = 1;
+static const char16 * scenarioFilter = nullptr;
+static const char16 * jsonFile = nullptr;
+
+//////////////////// Begin timing helpers ////////////////////
+
+static double GetTimeMs()
+{
+    static LARGE_INTEGER frequency = { 0 };
+    if (frequency.QuadPart == 0)
+    {
+        QueryPerformanceFrequency(&frequency);
+    }
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart * 1000.0 / (double)frequency.QuadPart;
+}
+
+static size_t GetResidentSetBytes()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS memCounters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &memCounters, sizeof(memCounters)))
+    {
+        return memCounters.WorkingSetSize;
+    }
+    return 0;
+#else
+    size_t pages = 0;
+    size_t residentPages = 0;
+    FILE * statm = fopen("/proc/self/statm", "r");
+    if (statm == nullptr)
+    {
+        return 0;
+    }
+    if (fscanf(statm, "%zu %zu", &pages, &residentPages) != 2)
+    {
+        residentPages = 0;
+    }
+    fclose(statm);
+    return residentPages * AutoSystemInfo::PageSize;
+#endif
+}
+
+// Growable list of samples. (STL is avoided here for the same reasons as in WeightedTable.)
+class SampleList
+{
+public:
+    SampleList() : samples(nullptr), count(0), capacity(0) {}
+    ~SampleList() { free(samples); }
+
+    void Add(double value)
+    {
+        if (count == capacity)
+        {
+            size_t newCapacity = capacity == 0 ? 64 : capacity * 2;
+            double * newSamples = static_cast<double *>(realloc(samples, newCapacity * sizeof(double)));
+            if (newSamples == nullptr)
+            {
+                throw "OOM in SampleList::Add realloc";
+            }
+            samples = newSamples;
+            capacity = newCapacity;
+        }
+        samples[count++] = value;
+    }
+
+    void Clear() { count = 0; }
+    size_t Count() const { return count; }
+
+    double Sum() const
+    {
+        double sum = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            sum += samples[i];
+        }
+        return sum;
+    }
+
+    // Nearest-rank percentile; sorts the samples in place.
+    double Percentile(double percent)
+    {
+        if (count == 0)
+        {
+            return 0;
+        }
+        qsort(samples, count, sizeof(double), CompareDouble);
+        size_t rank = (size_t)ceil(percent / 100.0 * count);
+        return samples[rank == 0 ? 0 : rank - 1];
+    }
+
+private:
+    static int __cdecl CompareDouble(const void * a, const void * b)
+    {
+        double left = *static_cast<const double *>(a);
+        double right = *static_cast<const double *>(b);
+        return left < right ? -1 : (left > right ? 1 : 0);
+    }
+
+    double * samples;
+    size_t count;
+    size_t capacity;
+};
+
+//////////////////// End timing helpers ////////////////////
+
+//////////////////// Begin collection instrumentation ////////////////////
+
+// Wraps every foreground collection entry point so we can time the pauses the script thread
+// sees, and records phase boundaries from the collection callbacks. With concurrent GC enabled
+// the mark/sweep phases partially run in the background; those times are wall clock between
+// callbacks and are not pauses.
+class BenchCollectionWrapper : public DefaultRecyclerCollectionWrapper
+{
+public:
+    BenchCollectionWrapper() :
+        collectionCount(0), collectionStart(0), markEnd(0), sweepStart(0),
+        totalMarkTime(0), totalSweepTime(0), maxUsedBytes(0)
+    {
+    }
+
+    virtual BOOL ExecuteRecyclerCollectionFunction(Recycler * recycler, CollectionFunction function, CollectionFlags flags) override
+    {
+        double start = GetTimeMs();
+        BOOL ret = DefaultRecyclerCollectionWrapper::ExecuteRecyclerCollectionFunction(recycler, function, flags);
+        pauses.Add(GetTimeMs() - start);
+        return ret;
+    }
+
+    virtual void DisposeObjects(Recycler * recycler) override
+    {
+        double start = GetTimeMs();
+        DefaultRecyclerCollectionWrapper::DisposeObjects(recycler);
+        disposePauses.Add(GetTimeMs() - start);
+    }
+
+    virtual void PreCollectionCallBack(CollectionFlags flags) override
+    {
+        collectionCount++;
+        collectionStart = GetTimeMs();
+        markEnd = 0;
+        sweepStart = 0;
+
+        size_t usedBytes = recyclerInstance->GetUsedBytes();
+        maxUsedBytes = max(maxUsedBytes, usedBytes);
+    }
+
+    virtual void EndMarkCallback() override
+    {
+        markEnd = GetTimeMs();
+        totalMarkTime += markEnd - collectionStart;
+    }
+
+    virtual void PreSweepCallback() override
+    {
+        sweepStart = GetTimeMs();
+    }
+
+    virtual void PostCollectionCallBack() override
+    {
+        if (sweepStart != 0)
+        {
+            totalSweepTime += GetTimeMs() - sweepStart;
+        }
+    }
+
+    void Reset()
+    {
+        collectionCount = 0;
+        totalMarkTime = 0;
+        totalSweepTime = 0;
+        maxUsedBytes = 0;
+        pauses.Clear();
+        disposePauses.Clear();
+    }
+
+    size_t collectionCount;
+    double collectionStart;
+    double markEnd;
+    double sweepStart;
+    double totalMarkTime;
+    double totalSweepTime;
+    size_t maxUsedBytes;
+    SampleList pauses;
+    SampleList disposePauses;
+};
+
+static BenchCollectionWrapper collectionWrapper;
+
+//////////////////// End collection instrumentation ////////////////////
+
+//////////////////// Begin scenarios ////////////////////
+
+// Roots live in a scanned stack array owned by the scenario driver.
+static const unsigned int rootCount = 256;
+
+struct ScenarioContext
+{
+    RecyclerTestObject ** roots;
+    size_t allocCount;
+};
+
+typedef RecyclerTestObject * (*ObjectCreationFunc)(void);
+
+static void Allocate(ScenarioContext& context, ObjectCreationFunc creationFunc, unsigned int rootIndex)
+{
+    context.roots[rootIndex % rootCount] = creationFunc();
+    context.allocCount++;
+}
+
+// Hang a new object off a random slot inside an existing root's subgraph, so the graph survives.
+static void AllocateIntoGraph(ScenarioContext& context, ObjectCreationFunc creationFunc)
+{
+    RecyclerTestObject * parent = context.roots[GetRandomInteger(rootCount)];
+    RecyclerTestObject * object = creationFunc();
+    context.allocCount++;
+
+    Location location = Location::Scanned(&context.roots[GetRandomInteger(rootCount)]);
+    for (unsigned int depth = 0; parent != nullptr && depth < 16; depth++)
+    {
+        if (!parent->TryGetRandomLocation(&location))
+        {
+            break;
+        }
+        parent = location.Get();
+    }
+
+    location.Set(object);
+}
+
+// Short-lived bursts of small objects separated by idle periods with only a small live set
+static void BurstyScenario(ScenarioContext& context)
+{
+    const unsigned int bursts = 100 * scale;
+    for (unsigned int burst = 0; burst < bursts; burst++)
+    {
+        for (unsigned int i = 0; i < 20000; i++)
+        {
+            Allocate(context, &ScannedObject<1, 8>::New, i);
+        }
+        // Drop most of the burst; keep a handful alive into the next burst
+        for (unsigned int i = 16; i < rootCount; i++)
+        {
+            context.roots[i] = nullptr;
+        }
+    }
+}
+
+// Build a large connected graph that stays alive, then churn temporary objects next to it
+static void LongLivedGraphScenario(ScenarioContext& context)
+{
+    for (unsigned int i = 0; i < rootCount; i++)
+    {
+        Allocate(context, &ScannedObject<8, 32>::New, i);
+    }
+
+    const unsigned int graphSize = 200000 * scale;
+    for (unsigned int i = 0; i < graphSize; i++)
+    {
+        AllocateIntoGraph(context, &ScannedObject<1, 16>::New);
+    }
+
+    // Temporaries die immediately; only the graph above survives
+    const unsigned int churn = 1000000 * scale;
+    for (unsigned int i = 0; i < churn; i++)
+    {
+        ScannedObject<1, 8>::New();
+        context.allocCount++;
+    }
+}
+
+// Mostly leaf (pointer free) allocations, e.g. strings and number buffers
+static void LeafHeavyScenario(ScenarioContext& context)
+{
+    const unsigned int count = 2000000 * scale;
+    for (unsigned int i = 0; i < count; i++)
+    {
+        if (GetRandomInteger(10) == 0)
+        {
+            Allocate(context, &ScannedObject<1, 8>::New, i);
+        }
+        else
+        {
+            Allocate(context, &LeafObject<1, 64>::New, i);
+        }
+    }
+}
+
+// Objects above the small and medium size classes (LargeHeapBlock allocations)
+static void LargeObjectScenario(ScenarioContext& context)
+{
+    const unsigned int count = 20000 * scale;
+    for (unsigned int i = 0; i < count; i++)
+    {
+        if (GetRandomInteger(4) == 0)
+        {
+            Allocate(context, &ScannedObject<1001, 50000>::New, i);
+        }
+        else
+        {
+            Allocate(context, &LeafObject<1001, 50000>::New, i);
+        }
+    }
+}
+
+// Finalizable objects, which add dispose work after every collection
+static void FinalizerScenario(ScenarioContext& context)
+{
+    const unsigned int count = 500000 * scale;
+    for (unsigned int i = 0; i < count; i++)
+    {
+        if (GetRandomInteger(8) == 0)
+        {
+            Allocate(context, &FinalizedObject<1001, 4000>::New, i);
+        }
+        else
+        {
+            Allocate(context, &TrackedObject<1, 16>::New, i);
+        }
+    }
+}
+
+typedef void (*ScenarioFunc)(ScenarioContext& context);
+
+struct Scenario
+{
+    const char16 * name;
+    ScenarioFunc func;
+};
+
+static const Scenario scenarios[] =
+{
+    { _u("bursty"), &BurstyScenario },
+    { _u("longlived"), &LongLivedGraphScenario },
+    { _u("leaf"), &LeafHeavyScenario },
+    { _u("large"), &LargeObjectScenario },
+    { _u("finalizer"), &FinalizerScenario },
+};
+
+struct ScenarioResult
+{
+    const char16 * name;
+    double elapsedMs;
+    size_t allocCount;
+    size_t collectionCount;
+    double pauseP50;
+    double pauseP90;
+    double pauseP99;
+    double pauseMax;
+    double pauseTotal;
+    double disposeTotal;
+    double markTotal;
+    double sweepTotal;
+    size_t maxUsedBytes;
+    size_t residentBytes;
+};
+
+static void RunScenario(const Scenario& scenario, ScenarioResult& result)
+{
+    srand(seed);
+    collectionWrapper.Reset();
+
+    // Stack roots, scanned conservatively by the recycler
+    RecyclerTestObject * roots[rootCount];
+    for (unsigned int i = 0; i < rootCount; i++)
+    {
+        roots[i] = nullptr;
+    }
+
+    ScenarioContext context = { roots, 0 };
+
+    double start = GetTimeMs();
+    scenario.func(context);
+    double elapsed = GetTimeMs() - start;
+
+    result.name = scenario.name;
+    result.elapsedMs = elapsed;
+    result.allocCount = context.allocCount;
+    result.collectionCount = collectionWrapper.collectionCount;
+    result.pauseTotal = collectionWrapper.pauses.Sum();
+    result.pauseP50 = collectionWrapper.pauses.Percentile(50);
+    result.pauseP90 = collectionWrapper.pauses.Percentile(90);
+    result.pauseP99 = collectionWrapper.pauses.Percentile(99);
+    result.pauseMax = collectionWrapper.pauses.Percentile(100);
+    result.disposeTotal = collectionWrapper.disposePauses.Sum();
+    result.markTotal = collectionWrapper.totalMarkTime;
+    result.sweepTotal = collectionWrapper.totalSweepTime;
+    result.maxUsedBytes = collectionWrapper.maxUsedBytes;
+    result.residentBytes = GetResidentSetBytes();
+
+    // Drop everything and collect so the next scenario starts from an empty heap
+    for (unsigned int i = 0; i < rootCount; i++)
+    {
+        roots[i] = nullptr;
+    }
+    recyclerInstance->CollectNow<CollectNowForceInThread>();
+    recyclerInstance->FinishDisposeObjectsNow<FinishDispose>();
+}
+
+static void PrintResult(const ScenarioResult& result)
+{
+    wprintf(_u("%-10s %10.0f allocs/s %6llu GCs  pause p50 %7.3f p90 %7.3f p99 %7.3f max %7.3f total %9.2f ms  ")
+        _u("mark %9.2f ms  sweep %9.2f ms  dispose %8.2f ms  heap %7.1f MB  rss %7.1f MB\n"),
+        result.name,
+        result.allocCount / (result.elapsedMs / 1000.0),
+        (unsigned long long)result.collectionCount,
+        result.pauseP50, result.pauseP90, result.pauseP99, result.pauseMax, result.pauseTotal,
+        result.markTotal, result.sweepTotal, result.disposeTotal,
+        result.maxUsedBytes / (1024.0 * 1024.0),
+        result.residentBytes / (1024.0 * 1024.0));
+}
+
+static void WriteJson(const ScenarioResult * results, unsigned int count)
+{
+    char * fileName = nullptr;
+#ifdef _WIN32
+    size_t length = wcslen(jsonFile) + 1;
+    fileName = (char *)malloc(length * 2);
+    size_t converted;
+    wcstombs_s(&converted, fileName, length * 2, jsonFile, _TRUNCATE);
+#else
+    fileName = UTIL_WCToMB_Alloc(jsonFile, -1);
+#endif
+    FILE * file = fileName ? fopen(fileName, "w") : nullptr;
+    free(fileName);
+    if (file == nullptr)
+    {
+        wprintf(_u("Error: unable to write '%s'\n"), jsonFile);
+        return;
+    }
+
+    fprintf(file, "{\n  \"scale\": %u,\n  \"seed\": %u,\n  \"scenarios\": [\n", scale, seed);
+    for (unsigned int i = 0; i < count; i++)
+    {
+        const ScenarioResult& result = results[i];
+        char name[32];
+        size_t j = 0;
+        for (; result.name[j] != 0 && j < _countof(name) - 1; j++)
+        {
+            name[j] = (char)result.name[j];
+        }
+        name[j] = 0;
+
+        fprintf(file,
+            "    {\"name\": \"%s\", \"elapsedMs\": %.3f, \"allocCount\": %llu, \"allocsPerSec\": %.1f, "
+            "\"collections\": %llu, \"pauseP50Ms\": %.4f, \"pauseP90Ms\": %.4f, \"pauseP99Ms\": %.4f, "
+            "\"pauseMaxMs\": %.4f, \"pauseTotalMs\": %.3f, \"markMs\": %.3f, \"sweepMs\": %.3f, "
+            "\"disposeMs\": %.3f, \"maxHeapBytes\": %llu, \"rssBytes\": %llu}%s\n",
+            name, result.elapsedMs, (unsigned long long)result.allocCount,
+            result.allocCount / (result.elapsedMs / 1000.0),
+            (unsigned long long)result.collectionCount,
+            result.pauseP50, result.pauseP90, result.pauseP99, result.pauseMax, result.pauseTotal,
+            result.markTotal, result.sweepTotal, result.disposeTotal,
+            (unsigned long long)result.maxUsedBytes, (unsigned long long)result.residentBytes,
+            i + 1 < count ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+    fclose(file);
+}
+
+void RecyclerBenchmark()
+{
+#if ENABLE_BACKGROUND_PAGE_FREEING
+    PageAllocator::BackgroundPageQueue backgroundPageQueue;
+#endif
+    IdleDecommitPageAllocator pageAllocator(nullptr,
+        PageAllocatorType::PageAllocatorType_Thread,
+        Js::Configuration::Global.flags,
+        0 /* maxFreePageCount */, PageAllocator::DefaultMaxFreePageCount /* maxIdleFreePageCount */,
+        false /* zero pages */
+#if ENABLE_BACKGROUND_PAGE_FREEING
+        , &backgroundPageQueue
+#endif
+        );
+
+    ScenarioResult results[_countof(scenarios)];
+    unsigned int resultCount = 0;
+
+    try
+    {
+#ifdef EXCEPTION_CHECK
+        AUTO_NESTED_HANDLED_EXCEPTION_TYPE(ExceptionType_DisableCheck);
+#endif
+
+        recyclerInstance = HeapNewZ(Recycler, nullptr, &pageAllocator, Js::Throw::OutOfMemory, Js::Configuration::Global.flags, nullptr);
+        recyclerInstance->Initialize(false /* forceInThread */, nullptr /* threadService */);
+        recyclerInstance->SetCollectionWrapper(&collectionWrapper);
+
+        for (unsigned int i = 0; i < _countof(scenarios); i++)
+        {
+            if (scenarioFilter != nullptr && wcscmp(scenarioFilter, scenarios[i].name) != 0)
+            {
+                continue;
+            }
+
+            RunScenario(scenarios[i], results[resultCount]);
+            PrintResult(results[resultCount]);
+            resultCount++;
+        }
+    }
+    catch (Js::OutOfMemoryException)
+    {
+        printf("Error: OOM\n");
+    }
+
+    if (jsonFile != nullptr)
+    {
+        WriteJson(results, resultCount);
+    }
+}
+
+//////////////////// End scenarios ////////////////////
+
+//////////////////// Begin test stubs ////////////////////
+
+// This is consumed by AutoSystemInfo. AutoSystemInfo is in Chakra.Common.Core.lib, which is linked
+// into multiple DLLs. The hosting DLL provides the implementation of this function.
+_Success_(return)
+bool GetDeviceFamilyInfo(
+    _Out_opt_ ULONGLONG* /*pullUAPInfo*/,
+    _Out_opt_ ULONG* /*pulDeviceFamily*/,
+    _Out_opt_ ULONG* /*pulDeviceForm*/)
+{
+    return false;
+}
+
+//////////////////// End test stubs ////////////////////
+
+//////////////////// Begin program entrypoint ////////////////////
+
+void usage(const WCHAR* self)
+{
+    wprintf(
+        _u("usage: %s [-?] [-scenario <name>] [-scale <n>] [-seed <n>] [-json <file>] [-js <jscript options from here on>]\n")
+        _u("  -scenario <name>\n\trun only this scenario (bursty, longlived, leaf, large, finalizer)\n")
+        _u("  -scale <n>\n\tmultiply the allocation counts of every scenario by n\n")
+        _u("  -seed <n>\n\tseed for the allocation size distribution\n")
+        _u("  -json <file>\n\twrite machine readable results to file\n"),
+        self);
+}
+
+int __cdecl wmain(int argc, __in_ecount(argc) WCHAR* argv[])
+{
+    int jscriptOptions = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (wcscmp(argv[i], _u("-?")) == 0)
+        {
+            usage(argv[0]);
+            exit(1);
+        }
+        else if (wcscmp(argv[i], _u("-scenario")) == 0 && i + 1 < argc)
+        {
+            scenarioFilter = argv[++i];
+        }
+        else if (wcscmp(argv[i], _u("-scale")) == 0 && i + 1 < argc)
+        {
+            scale = max(1, (int)wcstol(argv[++i], nullptr, 10));
+        }
+        else if (wcscmp(argv[i], _u("-seed")) == 0 && i + 1 < argc)
+        {
+            seed = (unsigned int)wcstoul(argv[++i], nullptr, 10);
+        }
+        else if (wcscmp(argv[i], _u("-json")) == 0 && i + 1 < argc)
+        {
+            jsonFile = argv[++i];
+        }
+        else if (wcscmp(argv[i], _u("-js")) == 0 || wcscmp(argv[i], _u("-JS")) == 0)
+        {
+            jscriptOptions = i;
+            break;
+        }
+        else
+        {
+            wprintf(_u("unknown argument '%s'\n"), argv[i]);
+            usage(argv[0]);
+            exit(1);
+        }
+    }
+
+    // Parse the rest of the command line as js options
+    if (jscriptOptions)
+    {
+        CmdLineArgsParser parser(nullptr);
+        parser.Parse(argc - jscriptOptions, argv + jscriptOptions);
+    }
+
+    RecyclerBenchmark();
+
+    return 0;
+}
+
+#ifndef _WIN32
+int main(int argc, char** argv)
+{
+    char16** args = new char16*[argc];
+    for (int i = 0; i < argc; i++)
+    {
+        args[i] = UTIL_MBToWC_Alloc(argv[i], -1);
+    }
+
+    int ret = wmain(argc, args);
+
+    for (int i = 0; i < argc; i++)
+    {
+        free(args[i]);
+    }
+    delete[] args;
+
+    PAL_Shutdown();
+    return ret;
+}
+#endif
+//////////////////// End program entrypoint ////////////////////
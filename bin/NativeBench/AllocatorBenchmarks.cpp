@@ -0,0 +1,138 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "stdafx.h"
+
+using namespace NativeBench;
+
+namespace AllocatorBenchmarks
+{
+    static const int allocCount = 1024;
+
+    template <size_t size>
+    static void ArenaAllocBenchmark(State& state)
+    {
+        ArenaAllocator arena(_u("NativeBench"), GetPageAllocator(), OutOfMemory);
+        while (state.KeepRunning())
+        {
+            for (int i = 0; i < allocCount; i++)
+            {
+                DoNotOptimize(arena.Alloc(size));
+            }
+            arena.Reset();
+        }
+        state.SetItemsProcessed(state.Iterations() * allocCount);
+        state.SetBytesProcessed(state.Iterations() * allocCount * size);
+    }
+
+    BENCHMARK(ArenaAllocator_Alloc16)   { ArenaAllocBenchmark<16>(state); }
+    BENCHMARK(ArenaAllocator_Alloc128)  { ArenaAllocBenchmark<128>(state); }
+    BENCHMARK(ArenaAllocator_Alloc4K)   { ArenaAllocBenchmark<4096>(state); }
+
+    // Alloc/Free pairs go through the arena's free list buckets
+    BENCHMARK(ArenaAllocator_AllocFree64)
+    {
+        ArenaAllocator arena(_u("NativeBench"), GetPageAllocator(), OutOfMemory);
+        char * buffers[allocCount];
+        while (state.KeepRunning())
+        {
+            for (int i = 0; i < allocCount; i++)
+            {
+                buffers[i] = arena.Alloc(64);
+            }
+            for (int i = 0; i < allocCount; i++)
+            {
+                arena.Free(buffers[i], 64);
+            }
+        }
+        state.SetItemsProcessed(state.Iterations() * allocCount);
+    }
+
+    // Construction and teardown of an arena, as done per function by the parser and JIT
+    BENCHMARK(ArenaAllocator_CreateDestroy)
+    {
+        while (state.KeepRunning())
+        {
+            ArenaAllocator arena(_u("NativeBench"), GetPageAllocator(), OutOfMemory);
+            for (int i = 0; i < 64; i++)
+            {
+                DoNotOptimize(arena.Alloc(256));
+            }
+        }
+        state.SetItemsProcessed(state.Iterations());
+    }
+
+    template <size_t size>
+    static void HeapAllocBenchmark(State& state)
+    {
+        char * buffers[allocCount];
+        while (state.KeepRunning())
+        {
+            for (int i = 0; i < allocCount; i++)
+            {
+                buffers[i] = HeapAllocator::Instance.Alloc(size);
+            }
+            for (int i = 0; i < allocCount; i++)
+            {
+                HeapAllocator::Instance.Free(buffers[i], size);
+            }
+        }
+        state.SetItemsProcessed(state.Iterations() * allocCount);
+        state.SetBytesProcessed(state.Iterations() * allocCount * size);
+    }
+
+    BENCHMARK(HeapAllocator_AllocFree16)  { HeapAllocBenchmark<16>(state); }
+    BENCHMARK(HeapAllocator_AllocFree256) { HeapAllocBenchmark<256>(state); }
+    BENCHMARK(HeapAllocator_AllocFree4K)  { HeapAllocBenchmark<4096>(state); }
+
+    template <uint pageCount>
+    static void PageAllocBenchmark(State& state)
+    {
+        PageAllocator * pageAllocator = GetPageAllocator();
+        const int count = 64;
+        char * pages[count];
+        PageSegment * segments[count];
+        while (state.KeepRunning())
+        {
+            for (int i = 0; i < count; i++)
+            {
+                pages[i] = pageAllocator->AllocPages(pageCount, &segments[i]);
+                if (pages[i] == nullptr)
+                {
+                    OutOfMemory();
+                }
+            }
+            for (int i = 0; i < count; i++)
+            {
+                pageAllocator->ReleasePages(pages[i], pageCount, segments[i]);
+            }
+        }
+        state.SetItemsProcessed(state.Iterations() * count);
+        state.SetBytesProcessed(state.Iterations() * count * pageCount * AutoSystemInfo::PageSize);
+    }
+
+    BENCHMARK(PageAllocator_AllocRelease1)  { PageAllocBenchmark<1>(state); }
+    BENCHMARK(PageAllocator_AllocRelease4)  { PageAllocBenchmark<4>(state); }
+    BENCHMARK(PageAllocator_AllocRelease16) { PageAllocBenchmark<16>(state); }
+
+    // Pages that are released and immediately re-requested should come from the free page list;
+    // decommitting them on every release shows up here.
+    BENCHMARK(PageAllocator_FirstTouch)
+    {
+        PageAllocator * pageAllocator = GetPageAllocator();
+        while (state.KeepRunning())
+        {
+            PageSegment * segment;
+            char * page = pageAllocator->AllocPages(1, &segment);
+            if (page == nullptr)
+            {
+                OutOfMemory();
+            }
+            page[0] = 1;
+            ClobberMemory();
+            pageAllocator->ReleasePages(page, 1, segment);
+        }
+        state.SetItemsProcessed(state.Iterations());
+    }
+}
@@ -0,0 +1,210 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "stdafx.h"
+#include "Core/CRC.h"
+
+using namespace NativeBench;
+
+namespace ConversionBenchmarks
+{
+    static const charcount_t textLength = 4096;
+
+    // ASCII only text takes the fast paths in the codex
+    static void FillAscii(char16 * buffer, charcount_t length)
+    {
+        for (charcount_t i = 0; i < length; i++)
+        {
+            buffer[i] = (char16)(_u('a') + i % 26);
+        }
+    }
+
+    // Mix of 1, 2 and 3 byte encodings plus surrogate pairs
+    static void FillMixed(char16 * buffer, charcount_t length)
+    {
+        for (charcount_t i = 0; i < length; i++)
+        {
+            switch (i % 8)
+            {
+            case 0: buffer[i] = 0x00E9; break;  // 2 byte
+            case 1: buffer[i] = 0x4E2D; break;  // 3 byte
+            case 2: buffer[i] = 0xD83D; break;  // surrogate pair
+            case 3: buffer[i] = 0xDE00; break;
+            default: buffer[i] = (char16)(_u('a') + i % 26); break;
+            }
+        }
+    }
+
+    template <bool ascii>
+    static void EncodeBenchmark(State& state)
+    {
+        char16 source[textLength];
+        utf8char_t encoded[textLength * 3];
+        if (ascii)
+        {
+            FillAscii(source, textLength);
+        }
+        else
+        {
+            FillMixed(source, textLength);
+        }
+
+        while (state.KeepRunning())
+        {
+            size_t bytes = utf8::EncodeInto<utf8::Utf8EncodingKind::Cesu8>(encoded, sizeof(encoded), source, textLength);
+            DoNotOptimize(bytes);
+            ClobberMemory();
+        }
+        state.SetBytesProcessed(state.Iterations() * textLength * sizeof(char16));
+    }
+
+    template <bool ascii>
+    static void DecodeBenchmark(State& state)
+    {
+        char16 source[textLength];
+        utf8char_t encoded[textLength * 3];
+        char16 decoded[textLength * 3];
+        if (ascii)
+        {
+            FillAscii(source, textLength);
+        }
+        else
+        {
+            FillMixed(source, textLength);
+        }
+        size_t encodedLength = utf8::EncodeInto<utf8::Utf8EncodingKind::Cesu8>(encoded, sizeof(encoded), source, textLength);
+
+        while (state.KeepRunning())
+        {
+            LPCUTF8 start = encoded;
+            size_t chars = utf8::DecodeUnitsInto(decoded, start, encoded + encodedLength);
+            DoNotOptimize(chars);
+            ClobberMemory();
+        }
+        state.SetBytesProcessed(state.Iterations() * encodedLength);
+    }
+
+    BENCHMARK(Utf8Codex_EncodeAscii) { EncodeBenchmark<true>(state); }
+    BENCHMARK(Utf8Codex_EncodeMixed) { EncodeBenchmark<false>(state); }
+    BENCHMARK(Utf8Codex_DecodeAscii) { DecodeBenchmark<true>(state); }
+    BENCHMARK(Utf8Codex_DecodeMixed) { DecodeBenchmark<false>(state); }
+
+    BENCHMARK(Utf8Codex_CharacterIndexToByteIndex)
+    {
+        char16 source[textLength];
+        utf8char_t encoded[textLength * 3];
+        FillMixed(source, textLength);
+        size_t encodedLength = utf8::EncodeInto<utf8::Utf8EncodingKind::Cesu8>(encoded, sizeof(encoded), source, textLength);
+
+        size_t sum = 0;
+        while (state.KeepRunning())
+        {
+            sum += utf8::CharacterIndexToByteIndex(encoded, encodedLength, textLength - 1);
+        }
+        DoNotOptimize(sum);
+        state.SetBytesProcessed(state.Iterations() * encodedLength);
+    }
+
+    static const char16 * const numberStrings[] =
+    {
+        _u("0"), _u("42"), _u("-17"), _u("3.14159"), _u("2.718281828459045"), _u("1e21"),
+        _u("6.02214076e23"), _u("-0.000001"), _u("123456789012"), _u("1.7976931348623157e308"),
+        _u("5e-324"), _u("0.1")
+    };
+
+    BENCHMARK(NumberUtilities_StrToDbl)
+    {
+        double sum = 0;
+        while (state.KeepRunning())
+        {
+            for (size_t i = 0; i < _countof(numberStrings); i++)
+            {
+                const char16 * end;
+                LikelyNumberType likelyType = LikelyNumberType::Int;
+                sum += Js::NumberUtilities::StrToDbl<char16>(numberStrings[i], &end, likelyType);
+            }
+        }
+        DoNotOptimize(sum);
+        state.SetItemsProcessed(state.Iterations() * _countof(numberStrings));
+    }
+
+    static const double numberValues[] =
+    {
+        42, -17, 3.14159, 2.718281828459045, 1e21, 6.02214076e23, -0.000001, 123456789012,
+        1.7976931348623157e308, 5e-324, 0.1, 1.0 / 3
+    };
+
+    BENCHMARK(NumberUtilities_DblToStr)
+    {
+        char16 buffer[256];
+        while (state.KeepRunning())
+        {
+            for (size_t i = 0; i < _countof(numberValues); i++)
+            {
+                BOOL ok = Js::NumberUtilities::FNonZeroFiniteDblToStr(numberValues[i], buffer, _countof(buffer));
+                DoNotOptimize(ok);
+            }
+        }
+        state.SetItemsProcessed(state.Iterations() * _countof(numberValues));
+    }
+
+    BENCHMARK(NumberUtilities_DblToStrRadix16)
+    {
+        char16 buffer[1100];
+        while (state.KeepRunning())
+        {
+            for (size_t i = 0; i < _countof(numberValues); i++)
+            {
+                BOOL ok = Js::NumberUtilities::FNonZeroFiniteDblToStr(numberValues[i], 16, buffer, _countof(buffer));
+                DoNotOptimize(ok);
+            }
+        }
+        state.SetItemsProcessed(state.Iterations() * _countof(numberValues));
+    }
+
+    BENCHMARK(NumberUtilities_DblToStrFixed)
+    {
+        char16 buffer[256];
+        while (state.KeepRunning())
+        {
+            for (size_t i = 0; i < _countof(numberValues); i++)
+            {
+                int length = Js::NumberUtilities::FDblToStr(numberValues[i], Js::NumberUtilities::FormatFixed, 6, buffer, _countof(buffer));
+                DoNotOptimize(length);
+            }
+        }
+        state.SetItemsProcessed(state.Iterations() * _countof(numberValues));
+    }
+
+    BENCHMARK(CRC_Buffer4K)
+    {
+        byte buffer[4096];
+        for (size_t i = 0; i < sizeof(buffer); i++)
+        {
+            buffer[i] = (byte)(i * 31);
+        }
+
+        uint crc = 0;
+        while (state.KeepRunning())
+        {
+            crc = CalculateCRC(crc, sizeof(buffer), buffer);
+        }
+        DoNotOptimize(crc);
+        state.SetBytesProcessed(state.Iterations() * sizeof(buffer));
+    }
+
+    BENCHMARK(CRC32_Words)
+    {
+        uint crc = 0;
+        while (state.KeepRunning())
+        {
+            for (size_t i = 0; i < 512; i++)
+            {
+                crc = CalculateCRC32(crc, i);
+            }
+        }
+        DoNotOptimize(crc);
+        state.SetBytesProcessed(state.Iterations() * 512 * sizeof(size_t));
+    }
+}
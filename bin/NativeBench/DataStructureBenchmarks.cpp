@@ -0,0 +1,321 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "stdafx.h"
+
+using namespace NativeBench;
+
+namespace DataStructureBenchmarks
+{
+    static const int itemCount = 4096;
+
+    // Multiplicative hash so keys are spread over the table instead of sequential
+    inline int Key(int i)
+    {
+        return (int)((uint)i * 2654435761u);
+    }
+
+    typedef JsUtil::BaseDictionary<int, int, ArenaAllocator> IntDictionary;
+
+    BENCHMARK(BaseDictionary_Add)
+    {
+        ArenaAllocator arena(_u("NativeBench"), GetPageAllocator(), OutOfMemory);
+        while (state.KeepRunning())
+        {
+            {
+                IntDictionary dictionary(&arena);
+                for (int i = 0; i < itemCount; i++)
+                {
+                    dictionary.Add(Key(i), i);
+                }
+                DoNotOptimize(dictionary.Count());
+            }
+
+            state.PauseTiming();
+            arena.Reset();
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.Iterations() * itemCount);
+    }
+
+    BENCHMARK(BaseDictionary_TryGetValue_Hit)
+    {
+        ArenaAllocator arena(_u("NativeBench"), GetPageAllocator(), OutOfMemory);
+        IntDictionary dictionary(&arena);
+        for (int i = 0; i < itemCount; i++)
+        {
+            dictionary.Add(Key(i), i);
+        }
+
+        int sum = 0;
+        while (state.KeepRunning())
+        {
+            for (int i = 0; i < itemCount; i++)
+            {
+                int value;
+                if (dictionary.TryGetValue(Key(i), &value))
+                {
+                    sum += value;
+                }
+            }
+        }
+        DoNotOptimize(sum);
+        state.SetItemsProcessed(state.Iterations() * itemCount);
+    }
+
+    BENCHMARK(BaseDictionary_TryGetValue_Miss)
+    {
+        ArenaAllocator arena(_u("NativeBench"), GetPageAllocator(), OutOfMemory);
+        IntDictionary dictionary(&arena);
+        for (int i = 0; i < itemCount; i++)
+        {
+            dictionary.Add(Key(i), i);
+        }
+
+        int misses = 0;
+        while (state.KeepRunning())
+        {
+            for (int i = itemCount; i < itemCount * 2; i++)
+            {
+                int value;
+                if (!dictionary.TryGetValue(Key(i), &value))
+                {
+                    misses++;
+                }
+            }
+        }
+        DoNotOptimize(misses);
+        state.SetItemsProcessed(state.Iterations() * itemCount);
+    }
+
+    BENCHMARK(BaseDictionary_AddRemove)
+    {
+        ArenaAllocator arena(_u("NativeBench"), GetPageAllocator(), OutOfMemory);
+        IntDictionary dictionary(&arena);
+        while (state.KeepRunning())
+        {
+            for (int i = 0; i < itemCount; i++)
+            {
+                dictionary.Add(Key(i), i);
+            }
+            for (int i = 0; i < itemCount; i++)
+            {
+                dictionary.Remove(Key(i));
+            }
+        }
+        state.SetItemsProcessed(state.Iterations() * itemCount * 2);
+    }
+
+    BENCHMARK(BVSparse_SetSequential)
+    {
+        ArenaAllocator arena(_u("NativeBench"), GetPageAllocator(), OutOfMemory);
+        while (state.KeepRunning())
+        {
+            {
+                BVSparse<ArenaAllocator> bv(&arena);
+                for (BVIndex i = 0; i < itemCount; i++)
+                {
+                    bv.Set(i);
+                }
+                DoNotOptimize(bv.Count());
+            }
+
+            state.PauseTiming();
+            arena.Reset();
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.Iterations() * itemCount);
+    }
+
+    BENCHMARK(BVSparse_SetScattered)
+    {
+        ArenaAllocator arena(_u("NativeBench"), GetPageAllocator(), OutOfMemory);
+        while (state.KeepRunning())
+        {
+            {
+                BVSparse<ArenaAllocator> bv(&arena);
+                for (int i = 0; i < itemCount; i++)
+                {
+                    bv.Set((BVIndex)(Key(i) & 0xFFFFF));
+                }
+                DoNotOptimize(bv.Count());
+            }
+
+            state.PauseTiming();
+            arena.Reset();
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.Iterations() * itemCount);
+    }
+
+    BENCHMARK(BVSparse_Test)
+    {
+        ArenaAllocator arena(_u("NativeBench"), GetPageAllocator(), OutOfMemory);
+        BVSparse<ArenaAllocator> bv(&arena);
+        for (int i = 0; i < itemCount; i += 3)
+        {
+            bv.Set((BVIndex)i);
+        }
+
+        int hits = 0;
+        while (state.KeepRunning())
+        {
+            for (BVIndex i = 0; i < itemCount; i++)
+            {
+                hits += bv.Test(i) ? 1 : 0;
+            }
+        }
+        DoNotOptimize(hits);
+        state.SetItemsProcessed(state.Iterations() * itemCount);
+    }
+
+    BENCHMARK(BVSparse_Or)
+    {
+        ArenaAllocator arena(_u("NativeBench"), GetPageAllocator(), OutOfMemory);
+        BVSparse<ArenaAllocator> bv1(&arena);
+        BVSparse<ArenaAllocator> bv2(&arena);
+        for (int i = 0; i < itemCount; i++)
+        {
+            if (i % 2 == 0)
+            {
+                bv1.Set((BVIndex)i * 4);
+            }
+            else
+            {
+                bv2.Set((BVIndex)i * 4);
+            }
+        }
+
+        while (state.KeepRunning())
+        {
+            BVSparse<ArenaAllocator> result(&arena);
+            result.Copy(&bv1);
+            result.Or(&bv2);
+            DoNotOptimize(result.Count());
+        }
+        state.SetItemsProcessed(state.Iterations() * itemCount);
+    }
+
+    BENCHMARK(BVFixed_SetTest)
+    {
+        ArenaAllocator arena(_u("NativeBench"), GetPageAllocator(), OutOfMemory);
+        BVFixed * bv = BVFixed::New(itemCount, &arena);
+
+        int hits = 0;
+        while (state.KeepRunning())
+        {
+            for (BVIndex i = 0; i < itemCount; i += 3)
+            {
+                bv->Set(i);
+            }
+            for (BVIndex i = 0; i < itemCount; i++)
+            {
+                hits += bv->Test(i) ? 1 : 0;
+            }
+            bv->ClearAll();
+        }
+        DoNotOptimize(hits);
+        state.SetItemsProcessed(state.Iterations() * itemCount);
+    }
+
+    BENCHMARK(BVFixed_Count)
+    {
+        ArenaAllocator arena(_u("NativeBench"), GetPageAllocator(), OutOfMemory);
+        BVFixed * bv = BVFixed::New(itemCount * 16, &arena);
+        for (BVIndex i = 0; i < itemCount * 16; i += 7)
+        {
+            bv->Set(i);
+        }
+
+        BVIndex count = 0;
+        while (state.KeepRunning())
+        {
+            count += bv->Count();
+        }
+        DoNotOptimize(count);
+        state.SetBytesProcessed(state.Iterations() * itemCount * 16 / 8);
+    }
+
+    BENCHMARK(SList_PushPop)
+    {
+        ArenaAllocator arena(_u("NativeBench"), GetPageAllocator(), OutOfMemory);
+        SList<int> list(&arena);
+        int sum = 0;
+        while (state.KeepRunning())
+        {
+            for (int i = 0; i < itemCount; i++)
+            {
+                list.Push(i);
+            }
+            while (!list.Empty())
+            {
+                sum += list.Pop();
+            }
+        }
+        DoNotOptimize(sum);
+        state.SetItemsProcessed(state.Iterations() * itemCount);
+    }
+
+    BENCHMARK(SList_Iterate)
+    {
+        ArenaAllocator arena(_u("NativeBench"), GetPageAllocator(), OutOfMemory);
+        SList<int> list(&arena);
+        for (int i = 0; i < itemCount; i++)
+        {
+            list.Prepend(i);
+        }
+
+        int sum = 0;
+        while (state.KeepRunning())
+        {
+            FOREACH_SLIST_ENTRY(int, value, &list)
+            {
+                sum += value;
+            }
+            NEXT_SLIST_ENTRY;
+        }
+        DoNotOptimize(sum);
+        state.SetItemsProcessed(state.Iterations() * itemCount);
+    }
+
+    BENCHMARK(DList_AppendRemoveHead)
+    {
+        ArenaAllocator arena(_u("NativeBench"), GetPageAllocator(), OutOfMemory);
+        DList<int> list(&arena);
+        while (state.KeepRunning())
+        {
+            for (int i = 0; i < itemCount; i++)
+            {
+                list.Append(i);
+            }
+            while (!list.Empty())
+            {
+                list.RemoveHead();
+            }
+        }
+        state.SetItemsProcessed(state.Iterations() * itemCount);
+    }
+
+    BENCHMARK(DList_Iterate)
+    {
+        ArenaAllocator arena(_u("NativeBench"), GetPageAllocator(), OutOfMemory);
+        DList<int> list(&arena);
+        for (int i = 0; i < itemCount; i++)
+        {
+            list.Append(i);
+        }
+
+        int sum = 0;
+        while (state.KeepRunning())
+        {
+            FOREACH_DLIST_ENTRY(int, ArenaAllocator, value, &list)
+            {
+                sum += value;
+            }
+            NEXT_DLIST_ENTRY;
+        }
+        DoNotOptimize(sum);
+        state.SetItemsProcessed(state.Iterations() * itemCount);
+    }
+}
@@ -0,0 +1,302 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "stdafx.h"
+
+namespace NativeBench
+{
+    static Benchmark * benchmarkList = nullptr;
+    static Benchmark ** benchmarkListTail = &benchmarkList;
+
+    Benchmark::Benchmark(const char * name, BenchmarkFunc func) :
+        name(name), func(func), next(nullptr)
+    {
+        // Keep registration (declaration) order so output is stable
+        *benchmarkListTail = this;
+        benchmarkListTail = &this->next;
+    }
+
+    double GetTimeNs()
+    {
+        static LARGE_INTEGER frequency = { 0 };
+        if (frequency.QuadPart == 0)
+        {
+            QueryPerformanceFrequency(&frequency);
+        }
+        LARGE_INTEGER counter;
+        QueryPerformanceCounter(&counter);
+        return (double)counter.QuadPart * 1e9 / (double)frequency.QuadPart;
+    }
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    // Out of line so MSVC can't see that the pointer is unused
+    _NOINLINE void UseCharPointer(char const volatile *)
+    {
+    }
+#endif
+
+    static PageAllocator * pageAllocator = nullptr;
+
+    PageAllocator * GetPageAllocator()
+    {
+        return pageAllocator;
+    }
+
+    void OutOfMemory()
+    {
+        printf("Error: OOM\n");
+        exit(1);
+    }
+
+    struct Result
+    {
+        const char * name;
+        size_t iterations;
+        double meanNs;
+        double minNs;
+        double itemsPerSecond;
+        double bytesPerSecond;
+    };
+
+    static double minTimeMs = 100;
+    static unsigned int repetitions = 5;
+    static const char * filter = nullptr;
+    static const char * jsonFile = nullptr;
+    static bool csv = false;
+
+    static double RunOnce(Benchmark * benchmark, size_t iterations, size_t * items, size_t * bytes)
+    {
+        State state(iterations);
+        benchmark->func(state);
+        *items = state.ItemsProcessed();
+        *bytes = state.BytesProcessed();
+        return state.ElapsedNs();
+    }
+
+    static void RunBenchmark(Benchmark * benchmark, Result * result)
+    {
+        size_t items = 0;
+        size_t bytes = 0;
+
+        // Calibrate: grow the iteration count until one run takes at least minTimeMs
+        size_t iterations = 1;
+        double elapsedNs = 0;
+        while (true)
+        {
+            elapsedNs = RunOnce(benchmark, iterations, &items, &bytes);
+            if (elapsedNs >= minTimeMs * 1e6 || iterations >= ((size_t)1 << 40))
+            {
+                break;
+            }
+            double multiplier = elapsedNs > 0 ? (minTimeMs * 1e6 * 1.4) / elapsedNs : 10;
+            multiplier = min(max(multiplier, 2.0), 10.0);
+            iterations = (size_t)(iterations * multiplier);
+        }
+
+        double totalNs = elapsedNs;
+        double minNs = elapsedNs;
+        size_t totalItems = items;
+        size_t totalBytes = bytes;
+        for (unsigned int i = 1; i < repetitions; i++)
+        {
+            elapsedNs = RunOnce(benchmark, iterations, &items, &bytes);
+            totalNs += elapsedNs;
+            minNs = min(minNs, elapsedNs);
+            totalItems += items;
+            totalBytes += bytes;
+        }
+
+        result->name = benchmark->name;
+        result->iterations = iterations;
+        result->meanNs = totalNs / ((double)repetitions * iterations);
+        result->minNs = minNs / iterations;
+        result->itemsPerSecond = totalItems ? totalItems / (totalNs / 1e9) : 0;
+        result->bytesPerSecond = totalBytes ? totalBytes / (totalNs / 1e9) : 0;
+    }
+
+    static void PrintResult(const Result& result)
+    {
+        if (csv)
+        {
+            printf("%s,%llu,%.3f,%.3f,%.1f,%.1f\n", result.name, (unsigned long long)result.iterations,
+                result.meanNs, result.minNs, result.itemsPerSecond, result.bytesPerSecond);
+            return;
+        }
+
+        printf("%-44s %12.1f ns %12.1f ns %12llu", result.name, result.meanNs, result.minNs,
+            (unsigned long long)result.iterations);
+        if (result.itemsPerSecond)
+        {
+            printf("  %10.3fM items/s", result.itemsPerSecond / 1e6);
+        }
+        if (result.bytesPerSecond)
+        {
+            printf("  %10.3f MB/s", result.bytesPerSecond / (1024 * 1024));
+        }
+        printf("\n");
+    }
+
+    static void WriteJson(const Result * results, size_t count)
+    {
+        FILE * file = fopen(jsonFile, "w");
+        if (file == nullptr)
+        {
+            printf("Error: unable to write '%s'\n", jsonFile);
+            return;
+        }
+
+        fprintf(file, "{\n  \"minTimeMs\": %.1f,\n  \"repetitions\": %u,\n  \"benchmarks\": [\n", minTimeMs, repetitions);
+        for (size_t i = 0; i < count; i++)
+        {
+            fprintf(file,
+                "    {\"name\": \"%s\", \"iterations\": %llu, \"meanNs\": %.3f, \"minNs\": %.3f, "
+                "\"itemsPerSecond\": %.1f, \"bytesPerSecond\": %.1f}%s\n",
+                results[i].name, (unsigned long long)results[i].iterations, results[i].meanNs, results[i].minNs,
+                results[i].itemsPerSecond, results[i].bytesPerSecond, i + 1 < count ? "," : "");
+        }
+        fprintf(file, "  ]\n}\n");
+        fclose(file);
+    }
+
+    static int RunAll()
+    {
+        size_t count = 0;
+        for (Benchmark * benchmark = benchmarkList; benchmark != nullptr; benchmark = benchmark->next)
+        {
+            count++;
+        }
+
+        Result * results = HeapNewArrayZ(Result, count);
+        size_t resultCount = 0;
+
+        if (csv)
+        {
+            printf("name,iterations,meanNs,minNs,itemsPerSecond,bytesPerSecond\n");
+        }
+        else
+        {
+            printf("%-44s %15s %15s %12s\n", "Benchmark", "Mean", "Min", "Iterations");
+            printf("----------------------------------------------------------------------------------------------\n");
+        }
+
+        for (Benchmark * benchmark = benchmarkList; benchmark != nullptr; benchmark = benchmark->next)
+        {
+            if (filter != nullptr && strstr(benchmark->name, filter) == nullptr)
+            {
+                continue;
+            }
+            RunBenchmark(benchmark, &results[resultCount]);
+            PrintResult(results[resultCount]);
+            resultCount++;
+        }
+
+        if (jsonFile != nullptr)
+        {
+            WriteJson(results, resultCount);
+        }
+
+        HeapDeleteArray(count, results);
+        return 0;
+    }
+}
+
+//////////////////// Begin test stubs ////////////////////
+
+// This is consumed by AutoSystemInfo. AutoSystemInfo is in Chakra.Common.Core.lib, which is linked
+// into multiple DLLs. The hosting DLL provides the implementation of this function.
+_Success_(return)
+bool GetDeviceFamilyInfo(
+    _Out_opt_ ULONGLONG* /*pullUAPInfo*/,
+    _Out_opt_ ULONG* /*pulDeviceFamily*/,
+    _Out_opt_ ULONG* /*pulDeviceForm*/)
+{
+    return false;
+}
+
+//////////////////// End test stubs ////////////////////
+
+//////////////////// Begin program entrypoint ////////////////////
+
+void usage(const char* self)
+{
+    printf(
+        "usage: %s [-?] [-filter <substring>] [-min_time <ms>] [-repetitions <n>] [-json <file>] [-csv]\n"
+        "  -filter <substring>\n\tonly run benchmarks whose name contains substring\n"
+        "  -min_time <ms>\n\tminimum time per measured run (default 100)\n"
+        "  -repetitions <n>\n\tmeasured runs per benchmark (default 5)\n"
+        "  -json <file>\n\twrite machine readable results to file\n"
+        "  -csv\n\tprint results as csv\n",
+        self);
+}
+
+int main(int argc, char** argv)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "-?") == 0)
+        {
+            usage(argv[0]);
+            exit(1);
+        }
+        else if (strcmp(argv[i], "-filter") == 0 && i + 1 < argc)
+        {
+            NativeBench::filter = argv[++i];
+        }
+        else if (strcmp(argv[i], "-min_time") == 0 && i + 1 < argc)
+        {
+            NativeBench::minTimeMs = max(1.0, atof(argv[++i]));
+        }
+        else if (strcmp(argv[i], "-repetitions") == 0 && i + 1 < argc)
+        {
+            NativeBench::repetitions = (unsigned int)max(1, atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "-json") == 0 && i + 1 < argc)
+        {
+            NativeBench::jsonFile = argv[++i];
+        }
+        else if (strcmp(argv[i], "-csv") == 0)
+        {
+            NativeBench::csv = true;
+        }
+        else
+        {
+            printf("unknown argument '%s'\n", argv[i]);
+            usage(argv[0]);
+            exit(1);
+        }
+    }
+
+    int ret = 0;
+    {
+#if ENABLE_BACKGROUND_PAGE_FREEING
+        PageAllocator::BackgroundPageQueue backgroundPageQueue;
+#endif
+        PageAllocator pageAllocator(nullptr, Js::Configuration::Global.flags, PageAllocatorType_Thread,
+            PageAllocator::DefaultMaxFreePageCount, false /* zero pages */
+#if ENABLE_BACKGROUND_PAGE_FREEING
+            , &backgroundPageQueue
+#endif
+            );
+        NativeBench::pageAllocator = &pageAllocator;
+
+        try
+        {
+            ret = NativeBench::RunAll();
+        }
+        catch (Js::OutOfMemoryException)
+        {
+            printf("Error: OOM\n");
+            ret = 1;
+        }
+
+        NativeBench::pageAllocator = nullptr;
+    }
+
+#ifndef _WIN32
+    PAL_Shutdown();
+#endif
+    return ret;
+}
+
+//////////////////// End program entrypoint ////////////////////
@@ -0,0 +1,121 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+// A minimal, dependency free benchmark harness modelled after Google Benchmark.
+//
+//  BENCHMARK(BaseDictionary_Add)
+//  {
+//      while (state.KeepRunning())
+//      {
+//          ...
+//      }
+//      state.SetItemsProcessed(state.Iterations() * itemsPerIteration);
+//  }
+//
+// The runner calibrates the iteration count until a run takes at least the minimum time,
+// then repeats the measurement and reports the mean/min time per iteration.
+
+namespace NativeBench
+{
+    double GetTimeNs();
+
+    class State
+    {
+    public:
+        State(size_t maxIterations) :
+            maxIterations(maxIterations), iterations(0), startTime(0), endTime(0), pausedTime(0), pauseStart(0),
+            itemsProcessed(0), bytesProcessed(0)
+        {
+        }
+
+        bool KeepRunning()
+        {
+            if (iterations == 0)
+            {
+                startTime = GetTimeNs();
+            }
+            if (iterations < maxIterations)
+            {
+                iterations++;
+                return true;
+            }
+            endTime = GetTimeNs();
+            return false;
+        }
+
+        // Exclude setup work inside the measurement loop
+        void PauseTiming() { pauseStart = GetTimeNs(); }
+        void ResumeTiming() { pausedTime += GetTimeNs() - pauseStart; }
+
+        size_t Iterations() const { return maxIterations; }
+        void SetItemsProcessed(size_t items) { itemsProcessed = items; }
+        void SetBytesProcessed(size_t bytes) { bytesProcessed = bytes; }
+
+        double ElapsedNs() const { return endTime - startTime - pausedTime; }
+        size_t ItemsProcessed() const { return itemsProcessed; }
+        size_t BytesProcessed() const { return bytesProcessed; }
+
+    private:
+        size_t maxIterations;
+        size_t iterations;
+        double startTime;
+        double endTime;
+        double pausedTime;
+        double pauseStart;
+        size_t itemsProcessed;
+        size_t bytesProcessed;
+    };
+
+    typedef void (*BenchmarkFunc)(State& state);
+
+    struct Benchmark
+    {
+        Benchmark(const char * name, BenchmarkFunc func);
+
+        const char * name;
+        BenchmarkFunc func;
+        Benchmark * next;
+    };
+
+    // Keep the compiler from optimizing away a computed value. The value is treated
+    // as read (in a register or in memory) by an empty asm statement, so no store is
+    // added to the measured loop.
+#if defined(_MSC_VER) && !defined(__clang__)
+    void UseCharPointer(char const volatile * ptr);
+
+    template <typename T>
+    inline void DoNotOptimize(T const& value)
+    {
+        UseCharPointer(&reinterpret_cast<char const volatile&>(value));
+        _ReadWriteBarrier();
+    }
+#else
+    template <typename T>
+    inline void DoNotOptimize(T const& value)
+    {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+#endif
+
+    // Keep the compiler from assuming memory is unchanged across iterations
+    inline void ClobberMemory()
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        _ReadWriteBarrier();
+#else
+        asm volatile("" : : : "memory");
+#endif
+    }
+
+    // Shared page allocator for benchmarks that need an ArenaAllocator
+    PageAllocator * GetPageAllocator();
+    void OutOfMemory();
+}
+
+#define BENCHMARK(name) \
+    static void BENCHMARK_##name(NativeBench::State& state); \
+    static NativeBench::Benchmark BENCHMARK_REGISTRATION_##name(#name, &BENCHMARK_##name); \
+    static void BENCHMARK_##name(NativeBench::State& state)
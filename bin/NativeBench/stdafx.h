@@ -0,0 +1,23 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include "TargetVer.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <winbase.h>
+
+#pragma warning(disable:4985)
+#include <intrin.h>
+
+#include <wtypes.h>
+#include <stdio.h>
+#endif
+
+#include "Common.h"
+#include "CommonInl.h"
+
+#include "NativeBench.h"
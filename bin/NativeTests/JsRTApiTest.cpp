@@ -140,6 +140,90 @@ namespace JsRTApiTest
         JsRTApiTest::RunWithAttributes(JsRTApiTest::WeakReferenceTest);
     }
 
+    // Creates the object out of the test's frame, so that a stale copy on the test's own stack can't keep it alive
+    __declspec(noinline) void CreateObjectOnFiberStack(void ** slot, JsWeakRef * weakRef)
+    {
+        JsValueRef object = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateObject(&object) == JsNoError);
+        REQUIRE(JsCreateWeakReference(object, weakRef) == JsNoError);
+        *slot = object;
+    }
+
+    __declspec(noinline) bool IsWeakReferenceAlive(JsWeakRef weakRef)
+    {
+        JsValueRef value = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetWeakReferenceValue(weakRef, &value) == JsNoError);
+        return value != JS_INVALID_REFERENCE;
+    }
+
+    void SuspendedStackTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        // Stand-in for the stack of a suspended fiber, the only place the object is referenced from
+        void ** fiberStack = new void *[64]();
+        JsWeakRef weakRef = JS_INVALID_REFERENCE;
+        CreateObjectOnFiberStack(&fiberStack[32], &weakRef);
+
+        JsSuspendedStackHandle stackHandle = nullptr;
+        CHECK(JsRegisterSuspendedStack(runtime, fiberStack + 64, fiberStack, &stackHandle) == JsErrorInvalidArgument);
+        REQUIRE(JsRegisterSuspendedStack(runtime, fiberStack, fiberStack + 64, &stackHandle) == JsNoError);
+        CHECK(stackHandle != nullptr);
+
+        CHECK(JsCollectGarbage(runtime) == JsNoError);
+        CHECK(IsWeakReferenceAlive(weakRef));
+
+        // Handles that aren't registered with the runtime are rejected
+        CHECK(JsUnregisterSuspendedStack(runtime, reinterpret_cast<JsSuspendedStackHandle>(fiberStack)) == JsErrorInvalidArgument);
+
+        CHECK(JsUnregisterSuspendedStack(runtime, stackHandle) == JsNoError);
+        CHECK(JsUnregisterSuspendedStack(runtime, stackHandle) == JsErrorInvalidArgument);
+
+        // Once the stack is unregistered, its contents no longer keep the object alive
+        CHECK(JsCollectGarbage(runtime) == JsNoError);
+        CHECK(!IsWeakReferenceAlive(weakRef));
+
+        delete[] fiberStack;
+    }
+
+    TEST_CASE("ApiTest_SuspendedStackTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::SuspendedStackTest);
+    }
+
+    void ExternalMemoryTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        const size_t externalSize = 1024 * 1024;
+
+        size_t usageBefore = 0;
+        REQUIRE(JsGetRuntimeMemoryUsage(runtime, &usageBefore) == JsNoError);
+
+        REQUIRE(JsAdjustExternalMemory(runtime, externalSize) == JsNoError);
+
+        size_t usageAfter = 0;
+        REQUIRE(JsGetRuntimeMemoryUsage(runtime, &usageAfter) == JsNoError);
+        CHECK(usageAfter >= usageBefore + externalSize);
+
+        REQUIRE(JsAdjustExternalMemory(runtime, -(int64_t)externalSize) == JsNoError);
+
+        // Can't release more than was reported
+        CHECK(JsAdjustExternalMemory(runtime, -1) == JsErrorInvalidArgument);
+        REQUIRE(JsAdjustExternalMemory(runtime, externalSize) == JsNoError);
+        CHECK(JsAdjustExternalMemory(runtime, -(int64_t)externalSize - 1) == JsErrorInvalidArgument);
+        REQUIRE(JsAdjustExternalMemory(runtime, -(int64_t)externalSize) == JsNoError);
+
+        // External memory counts toward the runtime memory limit
+        size_t memoryLimit = 0;
+        REQUIRE(JsGetRuntimeMemoryLimit(runtime, &memoryLimit) == JsNoError);
+        REQUIRE(JsGetRuntimeMemoryUsage(runtime, &usageBefore) == JsNoError);
+        REQUIRE(JsSetRuntimeMemoryLimit(runtime, usageBefore + externalSize) == JsNoError);
+        CHECK(JsAdjustExternalMemory(runtime, 2 * externalSize) == JsErrorOutOfMemory);
+        REQUIRE(JsSetRuntimeMemoryLimit(runtime, memoryLimit) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_ExternalMemoryTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ExternalMemoryTest);
+    }
+
     void ObjectsAndPropertiesTest1(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
     {
         JsValueRef object = JS_INVALID_REFERENCE;
@@ -299,6 +383,51 @@ namespace JsRTApiTest
         JsRTApiTest::RunWithAttributes(JsRTApiTest::CrossContextSetPropertyTest);
     }
 
+    static volatile LONG backgroundFinalizeCount = 0;
+    static volatile DWORD backgroundFinalizeThreadId = 0;
+
+    void CALLBACK BackgroundFinalizeCallback(void *data)
+    {
+        backgroundFinalizeThreadId = GetCurrentThreadId();
+        InterlockedIncrement(&backgroundFinalizeCount);
+    }
+
+    // Not inlined, so no reference to the objects is left on the test's stack when the GC scans it
+    __declspec(noinline) void CreateBackgroundFinalizedObjects(LONG objectCount)
+    {
+        for (LONG i = 0; i < objectCount; i++)
+        {
+            JsValueRef object = JS_INVALID_REFERENCE;
+            REQUIRE(JsCreateExternalObject((void *)0xdeadbeef, BackgroundFinalizeCallback, &object) == JsNoError);
+        }
+    }
+
+    TEST_CASE("ApiTest_BackgroundFinalizationTest", "[ApiTest]")
+    {
+        const LONG objectCount = 1000;
+        backgroundFinalizeCount = 0;
+        backgroundFinalizeThreadId = 0;
+        const DWORD scriptThreadId = GetCurrentThreadId();
+
+        JsRuntimeHandle runtime = JS_INVALID_RUNTIME_HANDLE;
+        REQUIRE(TestSetup(JsRuntimeAttributeEnableBackgroundFinalization, &runtime));
+
+        CreateBackgroundFinalizedObjects(objectCount);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+
+        // The collection only queues the callbacks, wait for the finalizer thread to pick them up
+        for (int i = 0; i < 1000 && backgroundFinalizeCount == 0; i++)
+        {
+            Sleep(10);
+        }
+        REQUIRE(backgroundFinalizeCount > 0);
+        CHECK(backgroundFinalizeThreadId != scriptThreadId);
+
+        // Disposing the runtime waits for the finalizer thread and runs whatever is still queued
+        TestCleanup(runtime);
+        CHECK(backgroundFinalizeCount == objectCount);
+    }
+
     void CrossContextFunctionCall(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
     {
         /*
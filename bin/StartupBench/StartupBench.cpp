@@ -0,0 +1,524 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "stdafx.h"
+
+// Measures JsCreateRuntime -> JsCreateContext -> first parse -> first run -> first use of the
+// JsBuiltIn and Intl library code -> JsDisposeRuntime.
+//
+// Cold samples run the sequence once in a fresh child process (the parent re-launches itself
+// with -child), so they include process wide one time costs such as PAL, ICU and thread
+// context setup. Warm samples repeat the sequence in a single process after a discarded
+// first run. Each sample also carries the engine side breakdown from Js::StartupStats.
+
+namespace StartupBench
+{
+    using Js::StartupStats;
+
+    enum Step
+    {
+        CreateRuntime,
+        CreateContext,
+        FirstParse,
+        FirstRun,
+        LibraryUse,
+        DisposeRuntime,
+        Total,
+        StepCount
+    };
+
+    static const char * const stepNames[StepCount] =
+    {
+        "CreateRuntime",
+        "CreateContext",
+        "FirstParse",
+        "FirstRun",
+        "LibraryUse",
+        "DisposeRuntime",
+        "Total"
+    };
+
+    // Steps are followed by the StartupStats phases
+    static const int MetricCount = StepCount + StartupStats::PhaseCount;
+
+    struct Sample
+    {
+        double ms[MetricCount];
+    };
+
+    static const char * GetMetricName(int metric)
+    {
+        return metric < StepCount ? stepNames[metric] : StartupStats::GetPhaseName((StartupStats::Phase)(metric - StepCount));
+    }
+
+    // Touches the deferred prototypes backed by JsBuiltIn.js and the Intl.js initializers
+    static const char libraryUseScript[] =
+        "[3, 1, 2].indexOf(2); [1, 2, 3].includes(3);"
+        "for (var x of [1, 2]) {}"
+        "typeof Intl !== 'undefined' && new Intl.NumberFormat('en-US').format(1234.5);"
+        "(1234.5).toLocaleString(); 'a'.localeCompare('b');";
+
+    static const char defaultScript[] =
+        "function fib(n) { return n < 2 ? n : fib(n - 1) + fib(n - 2); }"
+        "var o = { a: 1, b: 'two', c: [1, 2, 3] };"
+        "JSON.stringify(o) + fib(15);";
+
+    static char * script = nullptr;
+    static unsigned int iterations = 10;
+    static unsigned int warmIterations = 10;
+    static const char * jsonFile = nullptr;
+    static const char * self = nullptr;
+    static const char * scriptFile = nullptr;
+
+    static double GetTimeMs()
+    {
+        static LARGE_INTEGER frequency = { 0 };
+        if (frequency.QuadPart == 0)
+        {
+            QueryPerformanceFrequency(&frequency);
+        }
+        LARGE_INTEGER counter;
+        QueryPerformanceCounter(&counter);
+        return (double)counter.QuadPart * 1000 / (double)frequency.QuadPart;
+    }
+
+#define IfJsrtErrorFail(expr) \
+    do \
+    { \
+        JsErrorCode errorCode = (expr); \
+        if (errorCode != JsNoError) \
+        { \
+            fprintf(stderr, "Error: %s failed with 0x%x\n", #expr, (unsigned int)errorCode); \
+            return false; \
+        } \
+    } while (0)
+
+    static bool ParseAndRun(const char * source, JsSourceContext sourceContext, double * parseMs, double * runMs)
+    {
+        JsValueRef sourceString;
+        JsValueRef sourceUrl;
+        JsValueRef function;
+        JsValueRef undefined;
+        JsValueRef result;
+
+        double start = GetTimeMs();
+        IfJsrtErrorFail(JsCreateString(source, strlen(source), &sourceString));
+        IfJsrtErrorFail(JsCreateString("startup.js", strlen("startup.js"), &sourceUrl));
+        IfJsrtErrorFail(JsParse(sourceString, sourceContext, sourceUrl, JsParseScriptAttributeNone, &function));
+        double parsed = GetTimeMs();
+
+        IfJsrtErrorFail(JsGetUndefinedValue(&undefined));
+        IfJsrtErrorFail(JsCallFunction(function, &undefined, 1, &result));
+        double ran = GetTimeMs();
+
+        if (parseMs != nullptr)
+        {
+            *parseMs = parsed - start;
+        }
+        *runMs = ran - parsed;
+        return true;
+    }
+
+    static bool RunSequence(Sample * sample)
+    {
+        JsRuntimeHandle runtime;
+        JsContextRef context;
+        double * ms = sample->ms;
+
+        StartupStats::Reset();
+
+        double start = GetTimeMs();
+        IfJsrtErrorFail(JsCreateRuntime(JsRuntimeAttributeNone, nullptr, &runtime));
+        double created = GetTimeMs();
+        ms[CreateRuntime] = created - start;
+
+        IfJsrtErrorFail(JsCreateContext(runtime, &context));
+        IfJsrtErrorFail(JsSetCurrentContext(context));
+        ms[CreateContext] = GetTimeMs() - created;
+
+        if (!ParseAndRun(script, 0, &ms[FirstParse], &ms[FirstRun]))
+        {
+            return false;
+        }
+
+        // Parse and run are reported together; the interesting cost is the library code injection
+        if (!ParseAndRun(libraryUseScript, 1, nullptr, &ms[LibraryUse]))
+        {
+            return false;
+        }
+
+        double disposing = GetTimeMs();
+        IfJsrtErrorFail(JsSetCurrentContext(JS_INVALID_REFERENCE));
+        IfJsrtErrorFail(JsDisposeRuntime(runtime));
+        double end = GetTimeMs();
+        ms[DisposeRuntime] = end - disposing;
+        ms[Total] = end - start;
+
+        for (int i = 0; i < StartupStats::PhaseCount; i++)
+        {
+            ms[StepCount + i] = StartupStats::GetTimeMs((StartupStats::Phase)i);
+        }
+        return true;
+    }
+
+#undef IfJsrtErrorFail
+
+    static const char sampleTag[] = "STARTUP_SAMPLE";
+
+    // Child side of a cold sample: one sequence, printed as a single tagged line
+    static int RunChild()
+    {
+        Sample sample;
+        if (!RunSequence(&sample))
+        {
+            return 1;
+        }
+
+        printf("%s", sampleTag);
+        for (int i = 0; i < MetricCount; i++)
+        {
+            printf(" %.6f", sample.ms[i]);
+        }
+        printf("\n");
+        fflush(stdout);
+        return 0;
+    }
+
+    static bool RunColdSample(Sample * sample, double * processMs)
+    {
+        char command[2048];
+        if (scriptFile != nullptr)
+        {
+            snprintf(command, sizeof(command), "\"%s\" -child -script \"%s\"", self, scriptFile);
+        }
+        else
+        {
+            snprintf(command, sizeof(command), "\"%s\" -child", self);
+        }
+
+        double start = GetTimeMs();
+        FILE * child = popen(command, "r");
+        if (child == nullptr)
+        {
+            fprintf(stderr, "Error: unable to launch '%s'\n", command);
+            return false;
+        }
+
+        bool found = false;
+        char line[4096];
+        while (fgets(line, sizeof(line), child) != nullptr)
+        {
+            if (strncmp(line, sampleTag, strlen(sampleTag)) != 0)
+            {
+                continue;
+            }
+
+            char * cursor = line + strlen(sampleTag);
+            found = true;
+            for (int i = 0; i < MetricCount; i++)
+            {
+                char * next;
+                sample->ms[i] = strtod(cursor, &next);
+                if (next == cursor)
+                {
+                    found = false;
+                    break;
+                }
+                cursor = next;
+            }
+        }
+
+        int exitCode = pclose(child);
+        *processMs = GetTimeMs() - start;
+        if (!found || exitCode != 0)
+        {
+            fprintf(stderr, "Error: cold run failed (exit code %d)\n", exitCode);
+            return false;
+        }
+        return true;
+    }
+
+    struct Summary
+    {
+        unsigned int n;
+        double mean;
+        double stddev;
+        double min;
+        double max;
+    };
+
+    static void Summarize(const double * values, unsigned int count, Summary * summary)
+    {
+        summary->n = count;
+        summary->mean = 0;
+        summary->stddev = 0;
+        summary->min = count ? values[0] : 0;
+        summary->max = count ? values[0] : 0;
+        for (unsigned int i = 0; i < count; i++)
+        {
+            summary->mean += values[i];
+            summary->min = values[i] < summary->min ? values[i] : summary->min;
+            summary->max = values[i] > summary->max ? values[i] : summary->max;
+        }
+        if (count == 0)
+        {
+            return;
+        }
+        summary->mean /= count;
+        if (count > 1)
+        {
+            double sum = 0;
+            for (unsigned int i = 0; i < count; i++)
+            {
+                sum += (values[i] - summary->mean) * (values[i] - summary->mean);
+            }
+            summary->stddev = sqrt(sum / (count - 1));
+        }
+    }
+
+    // Metric summaries for one variant (cold or warm); metric MetricCount is the process wall time
+    struct Results
+    {
+        const char * variant;
+        Summary metrics[MetricCount + 1];
+    };
+
+    static void SummarizeSamples(const Sample * samples, const double * processMs, unsigned int count, Results * results)
+    {
+        double * values = new double[count > 0 ? count : 1];
+        for (int metric = 0; metric < MetricCount; metric++)
+        {
+            for (unsigned int i = 0; i < count; i++)
+            {
+                values[i] = samples[i].ms[metric];
+            }
+            Summarize(values, count, &results->metrics[metric]);
+        }
+        if (processMs != nullptr)
+        {
+            Summarize(processMs, count, &results->metrics[MetricCount]);
+        }
+        else
+        {
+            results->metrics[MetricCount] = results->metrics[Total];
+        }
+        delete[] values;
+    }
+
+    static void PrintResults(const Results& results)
+    {
+        printf("\n%s (%u samples)\n", results.variant, results.metrics[0].n);
+        printf("%-24s %12s %12s %12s %12s\n", "Phase", "Mean(ms)", "Min(ms)", "Max(ms)", "StdDev(ms)");
+        printf("----------------------------------------------------------------------------\n");
+        for (int metric = 0; metric < MetricCount; metric++)
+        {
+            const Summary& summary = results.metrics[metric];
+            printf("%s%-*s %12.3f %12.3f %12.3f %12.3f\n", metric < StepCount ? "" : "  ", metric < StepCount ? 24 : 22,
+                GetMetricName(metric), summary.mean, summary.min, summary.max, summary.stddev);
+            if (metric == Total)
+            {
+                printf("  (engine breakdown, inclusive)\n");
+            }
+        }
+        if (strcmp(results.variant, "cold") == 0)
+        {
+            const Summary& process = results.metrics[MetricCount];
+            printf("%-24s %12.3f %12.3f %12.3f %12.3f\n", "Process", process.mean, process.min, process.max, process.stddev);
+        }
+    }
+
+    static void WriteSummary(FILE * file, const Summary& summary)
+    {
+        fprintf(file, "{\"n\": %u, \"mean\": %.6f, \"stddev\": %.6f, \"min\": %.6f, \"max\": %.6f}",
+            summary.n, summary.mean, summary.stddev, summary.min, summary.max);
+    }
+
+    // Same layout as test/benchmarks/benchmark.py so that compare.py can diff two runs
+    static void WriteJson(const Results * results, int variantCount)
+    {
+        FILE * file = fopen(jsonFile, "w");
+        if (file == nullptr)
+        {
+            fprintf(stderr, "Error: unable to write '%s'\n", jsonFile);
+            return;
+        }
+
+        char date[64];
+        time_t now = time(nullptr);
+        strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+
+        fprintf(file, "{\n  \"binary\": \"%s\",\n  \"date\": \"%s\",\n  \"iterations\": %u,\n  \"warmup\": %u,\n  \"tests\": [",
+            self, date, iterations, warmIterations);
+        bool first = true;
+        for (int v = 0; v < variantCount; v++)
+        {
+            if (results[v].metrics[0].n == 0)
+            {
+                continue;
+            }
+            for (int metric = 0; metric < MetricCount; metric++)
+            {
+                fprintf(file, "%s\n    {\"suite\": \"startup\", \"test\": \"%s\", \"variant\": \"%s\", \"metric\": \"ms\", "
+                    "\"biggerIsBetter\": false, \"value\": ", first ? "" : ",", GetMetricName(metric), results[v].variant);
+                WriteSummary(file, results[v].metrics[metric]);
+                fprintf(file, ", \"wallTime\": ");
+                WriteSummary(file, results[v].metrics[MetricCount]);
+                fprintf(file, "}");
+                first = false;
+            }
+        }
+        fprintf(file, "\n  ]\n}\n");
+        fclose(file);
+    }
+
+    static bool LoadScript(const char * fileName)
+    {
+        FILE * file = fopen(fileName, "rb");
+        if (file == nullptr)
+        {
+            fprintf(stderr, "Error: unable to open '%s'\n", fileName);
+            return false;
+        }
+        fseek(file, 0, SEEK_END);
+        long length = ftell(file);
+        fseek(file, 0, SEEK_SET);
+        script = new char[length + 1];
+        size_t read = fread(script, 1, length, file);
+        script[read] = '\0';
+        fclose(file);
+        return true;
+    }
+
+    static int RunParent()
+    {
+        Results results[2];
+        results[0].variant = "cold";
+        results[1].variant = "warm";
+
+        Sample * samples = new Sample[(iterations > warmIterations ? iterations : warmIterations) + 1];
+        double * processMs = new double[iterations + 1];
+        int ret = 0;
+
+        unsigned int count = 0;
+        for (; count < iterations; count++)
+        {
+            if (!RunColdSample(&samples[count], &processMs[count]))
+            {
+                ret = 1;
+                break;
+            }
+        }
+        SummarizeSamples(samples, processMs, count, &results[0]);
+
+        count = 0;
+        if (ret == 0 && warmIterations > 0)
+        {
+            // The first sequence in this process is cold; discard it
+            Sample discard;
+            if (!RunSequence(&discard))
+            {
+                ret = 1;
+            }
+            for (; ret == 0 && count < warmIterations; count++)
+            {
+                if (!RunSequence(&samples[count]))
+                {
+                    ret = 1;
+                }
+            }
+        }
+        SummarizeSamples(samples, nullptr, ret == 0 ? count : 0, &results[1]);
+
+        if (results[0].metrics[0].n > 0)
+        {
+            PrintResults(results[0]);
+        }
+        if (results[1].metrics[0].n > 0)
+        {
+            PrintResults(results[1]);
+        }
+
+        if (jsonFile != nullptr)
+        {
+            WriteJson(results, 2);
+        }
+
+        delete[] processMs;
+        delete[] samples;
+        return ret;
+    }
+}
+
+void usage(const char* self)
+{
+    printf(
+        "usage: %s [-?] [-iterations <n>] [-warm <n>] [-script <file>] [-json <file>]\n"
+        "  -iterations <n>\n\tcold samples, one fresh process each (default 10)\n"
+        "  -warm <n>\n\twarm samples in this process (default 10)\n"
+        "  -script <file>\n\tscript used for the first parse and run (default: small built-in script)\n"
+        "  -json <file>\n\twrite results in the format read by test/benchmarks/compare.py\n",
+        self);
+}
+
+int main(int argc, char** argv)
+{
+    bool child = false;
+    StartupBench::self = argv[0];
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "-?") == 0)
+        {
+            usage(argv[0]);
+            exit(1);
+        }
+        else if (strcmp(argv[i], "-iterations") == 0 && i + 1 < argc)
+        {
+            StartupBench::iterations = (unsigned int)atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-warm") == 0 && i + 1 < argc)
+        {
+            StartupBench::warmIterations = (unsigned int)atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-script") == 0 && i + 1 < argc)
+        {
+            StartupBench::scriptFile = argv[++i];
+        }
+        else if (strcmp(argv[i], "-json") == 0 && i + 1 < argc)
+        {
+            StartupBench::jsonFile = argv[++i];
+        }
+        else if (strcmp(argv[i], "-child") == 0)
+        {
+            child = true;
+        }
+        else
+        {
+            printf("unknown argument '%s'\n", argv[i]);
+            usage(argv[0]);
+            exit(1);
+        }
+    }
+
+    if (StartupBench::scriptFile != nullptr)
+    {
+        if (!StartupBench::LoadScript(StartupBench::scriptFile))
+        {
+            return 1;
+        }
+    }
+    else
+    {
+        StartupBench::script = const_cast<char *>(StartupBench::defaultScript);
+    }
+
+    Js::StartupStats::SetEnabled(true);
+    int ret = child ? StartupBench::RunChild() : StartupBench::RunParent();
+
+    if (StartupBench::scriptFile != nullptr)
+    {
+        delete[] StartupBench::script;
+    }
+    return ret;
+}
@@ -0,0 +1,26 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include "CommonDefines.h"
+#include <CommonPal.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#define _JSRT_
+#include "ChakraCore.h"
+
+// Engine side breakdown of library initialization; only reachable because this host links
+// ChakraCoreStatic.
+#include "Base/StartupStats.h"
+
+#ifdef _WIN32
+#define popen _popen
+#define pclose _pclose
+#endif
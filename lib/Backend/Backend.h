@@ -152,6 +152,7 @@ enum IRDumpFlags
 #if defined(_M_X64)
 #include "PrologEncoder.h"
 #endif
+#include "JitPhaseStats.h"
 #include "Func.h"
 #include "TempTracker.h"
 #include "FlowGraph.h"
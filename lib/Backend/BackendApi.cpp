@@ -208,6 +208,14 @@ SetProfilerFromNativeCodeGen(NativeCodeGenerator * toNativeCodeGen, NativeCodeGe
 }
 #endif
 
+#ifdef BGJIT_STATS
+void
+PrintJitPhaseStats()
+{
+    JitPhaseStats::Print();
+}
+#endif
+
 void DeleteNativeCodeData(NativeCodeData * data)
 {
     if (data)
@@ -46,6 +46,9 @@ Func::Func(JitArenaAllocator *alloc, JITTimeWorkItem * workItem,
     anyPropertyMayBeWrittenTo(false),
 #ifdef PROFILE_EXEC
     m_codeGenProfiler(codeGenProfiler),
+#endif
+#ifdef BGJIT_STATS
+    m_phaseStats(nullptr),
 #endif
     m_isBackgroundJIT(isBackgroundJIT),
     m_cloner(nullptr),
@@ -217,6 +220,13 @@ Func::Func(JitArenaAllocator *alloc, JITTimeWorkItem * workItem,
         m_symTable->Init(this);
         m_symTable->SetStartingID(static_cast<SymID>(workItem->GetJITFunctionBody()->GetLocalsCount() + 1));
 
+#ifdef BGJIT_STATS
+        if (JitPhaseStats::IsEnabled())
+        {
+            m_phaseStats = JitAnew(alloc, JitPhaseStats, alloc->GetPageAllocator());
+        }
+#endif
+
         Assert(Js::Constants::NoByteCodeOffset == postCallByteCodeOffset);
         Assert(Js::Constants::NoRegister == returnValueRegSlot);
 
@@ -1280,6 +1290,13 @@ Func::BeginPhase(Js::Phase tag)
         this->m_codeGenProfiler->ProfileBegin(tag);
     }
 #endif
+
+#ifdef BGJIT_STATS
+    if (this->GetTopFunc()->m_phaseStats)
+    {
+        this->GetTopFunc()->m_phaseStats->BeginPhase(tag);
+    }
+#endif
 }
 
 ///----------------------------------------------------------------------------
@@ -1306,6 +1323,13 @@ Func::EndProfiler(Js::Phase tag)
         this->m_codeGenProfiler->ProfileEnd(tag);
     }
 #endif
+
+#ifdef BGJIT_STATS
+    if (this->GetTopFunc()->m_phaseStats)
+    {
+        this->GetTopFunc()->m_phaseStats->EndPhase(tag);
+    }
+#endif
 }
 
 void
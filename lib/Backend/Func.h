@@ -1049,6 +1049,9 @@ static const unsigned __int64 c_debugFillPattern8 = 0xcececececececece;
     JITOutput m_output;
 #ifdef PROFILE_EXEC
     Js::ScriptContextProfiler *const m_codeGenProfiler;
+#endif
+#ifdef BGJIT_STATS
+    JitPhaseStats *     m_phaseStats;
 #endif
     Func * const        topFunc;
     Func * const        parentFunc;
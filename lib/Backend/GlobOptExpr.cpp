@@ -829,6 +829,9 @@ GlobOpt::ProcessArrayValueKills(IR::Instr *instr)
     case Js::OpCode::DeleteFldStrict:
     case Js::OpCode::DeleteRootFldStrict:
     case Js::OpCode::StArrViewElem:
+    case Js::OpCode::WasmMemoryCopy:
+    case Js::OpCode::WasmMemoryFill:
+    case Js::OpCode::WasmMemoryInit:
     // These array helpers may change A.length (and A[i] could be A.length)...
     case Js::OpCode::InlineArrayPush:
     case Js::OpCode::InlineArrayPop:
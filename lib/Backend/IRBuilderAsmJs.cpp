@@ -1916,6 +1916,13 @@ IRBuilderAsmJs::BuildAsmReg1(Js::OpCodeAsmJs newOpcode, uint32 offset)
 void
 IRBuilderAsmJs::BuildAsmReg1(Js::OpCodeAsmJs newOpcode, uint32 offset, Js::RegSlot dstReg)
 {
+    if (newOpcode == Js::OpCodeAsmJs::DataDrop)
+    {
+        Js::RegSlot segmentRegSlot = GetRegSlotFromIntReg(dstReg);
+        BuildWasmBulkMemory(Js::OpCode::WasmDataDrop, BuildSrcOpnd(AsmJsRegSlots::ModuleMemReg, TyVar), &segmentRegSlot, 1, offset);
+        return;
+    }
+
     Assert(newOpcode == Js::OpCodeAsmJs::MemorySize_Int);
     Js::RegSlot dstRegSlot = GetRegSlotFromIntReg(dstReg);
     IR::RegOpnd * dstOpnd = BuildDstOpnd(dstRegSlot, TyInt32);
@@ -2513,6 +2520,33 @@ IRBuilderAsmJs::BuildInt2(Js::OpCodeAsmJs newOpcode, uint32 offset, Js::RegSlot
     }
 }
 
+void
+IRBuilderAsmJs::BuildInt4(Js::OpCodeAsmJs newOpcode, uint32 offset, Js::RegSlot segmentRegSlot, Js::RegSlot dstRegSlot, Js::RegSlot srcRegSlot, Js::RegSlot countRegSlot)
+{
+    Assert(newOpcode == Js::OpCodeAsmJs::MemoryInit);
+
+    // The data segments live in the module environment, the helper finds the memory there as well
+    const Js::RegSlot argSlots[] = { segmentRegSlot, dstRegSlot, srcRegSlot, countRegSlot };
+    BuildWasmBulkMemory(Js::OpCode::WasmMemoryInit, BuildSrcOpnd(AsmJsRegSlots::ModuleMemReg, TyVar), argSlots, _countof(argSlots), offset);
+}
+
+void
+IRBuilderAsmJs::BuildWasmBulkMemory(Js::OpCode opcode, IR::RegOpnd * targetOpnd, const Js::RegSlot * argSlots, uint argCount, uint32 offset)
+{
+    // The operands are chained with ExtendArg_A and passed to the helper by Lowerer::LowerWasmBulkMemory
+    IR::Instr * argInstr = AddExtendedArg(targetOpnd, nullptr, offset);
+    for (uint i = 0; i < argCount; i++)
+    {
+        IR::RegOpnd * argOpnd = BuildSrcOpnd(argSlots[i], TyInt32);
+        argOpnd->SetValueType(ValueType::GetInt(false));
+        argInstr = AddExtendedArg(argOpnd, argInstr->GetDst()->AsRegOpnd(), offset);
+    }
+
+    IR::Instr * instr = IR::Instr::New(opcode, m_func);
+    instr->SetSrc1(argInstr->GetDst());
+    AddInstr(instr, offset);
+}
+
 IR::RegOpnd* IRBuilderAsmJs::BuildTrapIfZero(IR::RegOpnd* srcOpnd, uint32 offset)
 {
     IR::RegOpnd* newSrc = IR::RegOpnd::New(srcOpnd->GetType(), m_func);
@@ -2541,6 +2575,15 @@ IR::Instr* IRBuilderAsmJs::CreateSignExtendInstr(IR::Opnd* dst, IR::Opnd* src, I
 void
 IRBuilderAsmJs::BuildInt3(Js::OpCodeAsmJs newOpcode, uint32 offset, Js::RegSlot dstRegSlot, Js::RegSlot src1RegSlot, Js::RegSlot src2RegSlot)
 {
+    if (newOpcode == Js::OpCodeAsmJs::MemoryCopy || newOpcode == Js::OpCodeAsmJs::MemoryFill)
+    {
+        // All three registers are operands, bulk memory operators don't produce a value
+        const Js::RegSlot argSlots[] = { dstRegSlot, src1RegSlot, src2RegSlot };
+        Js::OpCode opcode = newOpcode == Js::OpCodeAsmJs::MemoryCopy ? Js::OpCode::WasmMemoryCopy : Js::OpCode::WasmMemoryFill;
+        BuildWasmBulkMemory(opcode, BuildSrcOpnd(AsmJsRegSlots::WasmMemoryReg, TyVar), argSlots, _countof(argSlots), offset);
+        return;
+    }
+
     IR::RegOpnd * src1Opnd = BuildSrcOpnd(src1RegSlot, TyInt32);
     src1Opnd->SetValueType(ValueType::GetInt(false));
 
@@ -0,0 +1,119 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "Backend.h"
+
+#ifdef BGJIT_STATS
+
+JitPhaseStats::PhaseTotals JitPhaseStats::totals[Js::PhaseCount];
+CriticalSection JitPhaseStats::cs;
+
+JitPhaseStats::JitPhaseStats(PageAllocator * pageAllocator) :
+    pageAllocator(pageAllocator),
+    depth(0)
+{
+}
+
+void
+JitPhaseStats::BeginPhase(Js::Phase tag)
+{
+    uint index = this->depth++;
+    if (index >= MaxNesting)
+    {
+        return;
+    }
+
+    ActivePhase * phase = &this->activePhases[index];
+    phase->tag = tag;
+    phase->startUsedBytes = this->pageAllocator->GetUsedBytes();
+
+    // Restart the high-water mark for this phase; the enclosing phase's peak is restored when we end
+    phase->outerPeakUsedBytes = this->pageAllocator->GetPeakUsedBytes();
+    this->pageAllocator->SetPeakUsedBytes(phase->startUsedBytes);
+
+    LARGE_INTEGER ticks;
+    QueryPerformanceCounter(&ticks);
+    phase->startTicks = ticks.QuadPart;
+}
+
+void
+JitPhaseStats::EndPhase(Js::Phase tag)
+{
+    LARGE_INTEGER ticks;
+    QueryPerformanceCounter(&ticks);
+
+    Assert(this->depth > 0);
+    uint index = --this->depth;
+    if (index >= MaxNesting)
+    {
+        return;
+    }
+
+    ActivePhase * phase = &this->activePhases[index];
+    Assert(phase->tag == tag);
+
+    const LONGLONG elapsed = ticks.QuadPart - phase->startTicks;
+    const size_t peakUsedBytes = this->pageAllocator->GetPeakUsedBytes();
+    const size_t peakBytes = peakUsedBytes > phase->startUsedBytes ? peakUsedBytes - phase->startUsedBytes : 0;
+    this->pageAllocator->SetPeakUsedBytes(max(peakUsedBytes, phase->outerPeakUsedBytes));
+
+    AutoCriticalSection autoCS(&cs);
+    PhaseTotals * phaseTotals = &totals[tag];
+    phaseTotals->count++;
+    phaseTotals->ticks += elapsed;
+    phaseTotals->maxTicks = max(phaseTotals->maxTicks, elapsed);
+    phaseTotals->peakBytes += peakBytes;
+    phaseTotals->maxPeakBytes = max(phaseTotals->maxPeakBytes, peakBytes);
+}
+
+///----------------------------------------------------------------------------
+///
+/// JitPhaseStats::Print
+///
+///     Print the totals collected since the last call and reset them. The format
+///     is stable; test/benchmarks/jitbench.py parses it.
+///
+///----------------------------------------------------------------------------
+
+void
+JitPhaseStats::Print()
+{
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+    const double ticksPerMs = (double)frequency.QuadPart / 1000;
+
+    AutoCriticalSection autoCS(&cs);
+    if (totals[Js::BackEndPhase].count == 0)
+    {
+        return;
+    }
+
+    Output::Print(_u("JIT Phase Stats\n"));
+    Output::Print(_u("%-28s %8s %12s %10s %10s %14s %14s\n"),
+        _u("Phase"), _u("Count"), _u("Total(ms)"), _u("Mean(ms)"), _u("Max(ms)"), _u("MeanPeak(KB)"), _u("MaxPeak(KB)"));
+    Output::Print(_u("------------------------------------------------------------------------------------------------------\n"));
+
+    for (int i = 0; i < Js::PhaseCount; i++)
+    {
+        const PhaseTotals * phaseTotals = &totals[i];
+        if (phaseTotals->count == 0)
+        {
+            continue;
+        }
+        Output::Print(_u("%-28s %8u %12.3f %10.3f %10.3f %14.1f %14.1f\n"),
+            Js::PhaseNames[i],
+            phaseTotals->count,
+            phaseTotals->ticks / ticksPerMs,
+            phaseTotals->ticks / ticksPerMs / phaseTotals->count,
+            phaseTotals->maxTicks / ticksPerMs,
+            (double)phaseTotals->peakBytes / phaseTotals->count / 1024,
+            (double)phaseTotals->maxPeakBytes / 1024);
+    }
+    Output::Print(_u("------------------------------------------------------------------------------------------------------\n"));
+    Output::Flush();
+
+    memset(totals, 0, sizeof(totals));
+}
+
+#endif
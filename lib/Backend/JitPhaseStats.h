@@ -0,0 +1,62 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#ifdef BGJIT_STATS
+
+///---------------------------------------------------------------------------
+///
+/// class JitPhaseStats
+///
+///     Per-phase backend compile time and arena usage, enabled with -Stats:BackEnd.
+///     Unlike -Profile, this is available in all test builds and reports the peak
+///     number of JIT arena bytes in use while each phase runs, which is what bounds
+///     the memory cost of a compile.
+///
+///     One instance lives on each top level Func; totals are accumulated process wide
+///     (foreground and background JIT) and printed by the script context on close.
+///
+///---------------------------------------------------------------------------
+
+class JitPhaseStats
+{
+public:
+    JitPhaseStats(PageAllocator * pageAllocator);
+
+    void BeginPhase(Js::Phase tag);
+    void EndPhase(Js::Phase tag);
+
+    static bool IsEnabled() { return PHASE_STATS1(Js::BackEndPhase); }
+    static void Print();
+
+private:
+    struct ActivePhase
+    {
+        Js::Phase tag;
+        LONGLONG startTicks;
+        size_t startUsedBytes;
+        size_t outerPeakUsedBytes;
+    };
+
+    struct PhaseTotals
+    {
+        uint count;
+        LONGLONG ticks;
+        LONGLONG maxTicks;
+        size_t peakBytes;
+        size_t maxPeakBytes;
+    };
+
+    static const uint MaxNesting = 32;
+
+    PageAllocator * pageAllocator;
+    ActivePhase activePhases[MaxNesting];
+    uint depth;
+
+    static PhaseTotals totals[Js::PhaseCount];
+    static CriticalSection cs;
+};
+
+#endif
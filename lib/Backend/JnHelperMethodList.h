@@ -87,8 +87,11 @@ HELPERCALLCHK(Op_TypeofPropertyScoped, Js::JavascriptOperators::OP_TypeofPropert
 HELPERCALLCHK(Op_Rem_Double, Js::NumberUtilities::Modulus, AttrCanNotBeReentrant)
 
 #ifdef ENABLE_WASM
-HELPERCALLCHK(Op_CheckWasmSignature, Js::WebAssembly::CheckSignature, AttrCanThrow | AttrCanNotBeReentrant)
 HELPERCALLCHK(Op_GrowWasmMemory, Js::WebAssemblyMemory::GrowHelper, AttrCanNotBeReentrant)
+HELPERCALLCHK(Op_WasmMemoryCopy, Js::WebAssemblyMemory::CopyHelper, AttrCanThrow | AttrCanNotBeReentrant)
+HELPERCALLCHK(Op_WasmMemoryFill, Js::WebAssemblyMemory::FillHelper, AttrCanThrow | AttrCanNotBeReentrant)
+HELPERCALLCHK(Op_WasmMemoryInit, Js::WebAssemblyMemory::InitHelper, AttrCanThrow | AttrCanNotBeReentrant)
+HELPERCALLCHK(Op_WasmDataDrop, Js::WebAssemblyMemory::DataDropHelper, AttrCanNotBeReentrant)
 #if DBG
 HELPERCALLCHK(Op_WasmMemoryTraceWrite, Js::WebAssemblyMemory::TraceMemWrite, AttrCanNotBeReentrant)
 #endif
@@ -354,7 +357,6 @@ HELPERCALLCHK(AllocUninitializedNumber, Js::JavascriptOperators::AllocUninitiali
 
 #ifdef ENABLE_WASM_SIMD
 HELPERCALL(Simd128ShRtByScalarU2, Js::SIMDInt64x2Operation::OpShiftRightByScalarU, AttrCanNotBeReentrant)
-HELPERCALL(Simd128ShRtByScalarI2, Js::SIMDInt64x2Operation::OpShiftRightByScalar, AttrCanNotBeReentrant)
 HELPERCALL(Simd128ShLtByScalarI2, Js::SIMDInt64x2Operation::OpShiftLeftByScalar, AttrCanNotBeReentrant)
 HELPERCALL(Simd128ReplaceLaneI2, Js::SIMDInt64x2Operation::OpReplaceLane, AttrCanNotBeReentrant)
 HELPERCALL(Simd128TruncateI2, (void(*)(SIMDValue*, SIMDValue*))&Js::SIMDInt64x2Operation::OpTrunc<int64>, AttrCanThrow | AttrCanNotBeReentrant)
@@ -4624,6 +4624,13 @@ void LinearScan::PrintStats() const
     uint instrCount = 0;
     bool isInHelper = false;
 
+    // Spill loads and stores of each loop's own body (not counting nested loops), indexed by Loop::loopNumber
+    Loop * curLoop = nullptr;
+    const uint loopCount = this->func->loopCount;
+    uint * loopLoadCounts = loopCount != 0 ? JitAnewArrayZ(this->tempAlloc, uint, loopCount + 1) : nullptr;
+    uint * loopStoreCounts = loopCount != 0 ? JitAnewArrayZ(this->tempAlloc, uint, loopCount + 1) : nullptr;
+    Loop ** loops = loopCount != 0 ? JitAnewArrayZ(this->tempAlloc, Loop *, loopCount + 1) : nullptr;
+
     FOREACH_INSTR_IN_FUNC_BACKWARD(instr, this->func)
     {
         switch (instr->GetKind())
@@ -4635,6 +4642,13 @@ void LinearScan::PrintStats() const
             if (instr->AsBranchInstr()->IsLoopTail(this->func))
             {
                 loopNest++;
+
+                Loop * loop = instr->AsBranchInstr()->GetTarget()->GetLoop();
+                if (loop != nullptr && loop->loopNumber <= loopCount)
+                {
+                    loops[loop->loopNumber] = loop;
+                    curLoop = loop;
+                }
             }
 
             instrCount++;
@@ -4646,6 +4660,11 @@ void LinearScan::PrintStats() const
             {
                 Assert(loopNest);
                 loopNest--;
+
+                if (curLoop != nullptr && instr->AsLabelInstr()->GetLoop() == curLoop)
+                {
+                    curLoop = curLoop->parent;
+                }
             }
 
             isInHelper = instr->AsLabelInstr()->isOpHelper;
@@ -4665,6 +4684,10 @@ void LinearScan::PrintStats() const
                 {
                     storeCount++;
                     wStoreCount += LinearScan::GetUseSpillCost(loopNest, false);
+                    if (curLoop != nullptr)
+                    {
+                        loopStoreCounts[curLoop->loopNumber]++;
+                    }
                 }
                 IR::Opnd *src1 = instr->GetSrc1();
                 if (src1)
@@ -4673,12 +4696,20 @@ void LinearScan::PrintStats() const
                     {
                         loadCount++;
                         wLoadCount += LinearScan::GetUseSpillCost(loopNest, false);
+                        if (curLoop != nullptr)
+                        {
+                            loopLoadCounts[curLoop->loopNumber]++;
+                        }
                     }
                     IR::Opnd *src2 = instr->GetSrc2();
                     if (src2 && src2->IsSymOpnd() && src2->AsSymOpnd()->m_sym->IsStackSym() && src2->AsSymOpnd()->m_sym->AsStackSym()->IsAllocated())
                     {
                         loadCount++;
                         wLoadCount += LinearScan::GetUseSpillCost(loopNest, false);
+                        if (curLoop != nullptr)
+                        {
+                            loopLoadCounts[curLoop->loopNumber]++;
+                        }
                     }
                 }
             }
@@ -4693,6 +4724,29 @@ void LinearScan::PrintStats() const
 
     Output::Print(_u("Instrs:%5d, Lds:%4d, Strs:%4d, WLds: %4d, WStrs: %4d, WRefs: %4d\n"),
         instrCount, loadCount, storeCount, wLoadCount, wStoreCount, wLoadCount+wStoreCount);
+
+    for (uint i = 1; i <= loopCount; i++)
+    {
+        if (loops[i] == nullptr || (loopLoadCounts[i] == 0 && loopStoreCounts[i] == 0))
+        {
+            continue;
+        }
+
+        uint depth = 0;
+        for (Loop * parent = loops[i]->parent; parent != nullptr; parent = parent->parent)
+        {
+            depth++;
+        }
+
+        Output::Print(_u("    Loop %3u (depth %u): Lds:%4d, Strs:%4d\n"), loops[i]->loopNumber, depth, loopLoadCounts[i], loopStoreCounts[i]);
+    }
+
+    if (loopCount != 0)
+    {
+        JitAdeleteArray(this->tempAlloc, loopCount + 1, loopLoadCounts);
+        JitAdeleteArray(this->tempAlloc, loopCount + 1, loopStoreCounts);
+        JitAdeleteArray(this->tempAlloc, loopCount + 1, loops);
+    }
 }
 
 #endif
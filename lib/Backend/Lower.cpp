@@ -1775,6 +1775,18 @@ Lowerer::LowerRange(IR::Instr *instrStart, IR::Instr *instrEnd, bool defaultDoFa
         case Js::OpCode::GrowWasmMemory:
             instrPrev = this->LowerGrowWasmMemory(instr);
             break;
+        case Js::OpCode::WasmMemoryCopy:
+            instrPrev = this->LowerWasmBulkMemory(instr, IR::HelperOp_WasmMemoryCopy);
+            break;
+        case Js::OpCode::WasmMemoryFill:
+            instrPrev = this->LowerWasmBulkMemory(instr, IR::HelperOp_WasmMemoryFill);
+            break;
+        case Js::OpCode::WasmMemoryInit:
+            instrPrev = this->LowerWasmBulkMemory(instr, IR::HelperOp_WasmMemoryInit);
+            break;
+        case Js::OpCode::WasmDataDrop:
+            instrPrev = this->LowerWasmBulkMemory(instr, IR::HelperOp_WasmDataDrop);
+            break;
 #endif
         case Js::OpCode::Ld_I4:
             LowererMD::ChangeToAssign(instr);
@@ -8453,38 +8465,22 @@ Lowerer::LowerCheckWasmSignature(IR::Instr * instr)
 
     IR::Instr *instrPrev = instr->m_prev;
 
-    IR::IndirOpnd * actualSig = IR::IndirOpnd::New(instr->UnlinkSrc1()->AsRegOpnd(), Js::WasmScriptFunction::GetOffsetOfSignature(), TyMachReg, m_func);
-
+    // Every finalized signature has a key that is equal only for equivalent signatures,
+    // and the function object caches its signature's key, so the check is a single compare
     Wasm::WasmSignature * expectedSig = m_func->GetJITFunctionBody()->GetAsmJsInfo()->GetWasmSignature(sigId);
-    if (expectedSig->GetShortSig() == Js::Constants::InvalidSignature)
-    {
-        intptr_t sigAddr = m_func->GetJITFunctionBody()->GetAsmJsInfo()->GetWasmSignatureAddr(sigId);
-        IR::AddrOpnd * expectedOpnd = IR::AddrOpnd::New(sigAddr, IR::AddrOpndKindConstantAddress, m_func);
-        m_lowererMD.LoadHelperArgument(instr, expectedOpnd);
-        m_lowererMD.LoadHelperArgument(instr, actualSig);
+    Assert(expectedSig->GetShortSig() != Js::Constants::InvalidSignature);
 
-        LoadScriptContext(instr);
+    IR::IndirOpnd * actualSigKey = IR::IndirOpnd::New(instr->UnlinkSrc1()->AsRegOpnd(), Js::WasmScriptFunction::GetOffsetOfSignatureKey(), TyMachReg, m_func);
 
-        m_lowererMD.ChangeToHelperCall(instr, IR::HelperOp_CheckWasmSignature);
-    }
-    else
-    {
-        IR::LabelInstr * trapLabel = InsertLabel(true, instr);
-        IR::LabelInstr * labelFallThrough = InsertLabel(false, instr->m_next);
-        IR::RegOpnd * actualRegOpnd = IR::RegOpnd::New(TyMachReg, m_func);
-        InsertMove(actualRegOpnd, actualSig, trapLabel);
-
-        IR::IndirOpnd * shortSigIndir = IR::IndirOpnd::New(actualRegOpnd, Wasm::WasmSignature::GetOffsetOfShortSig(), TyMachReg, m_func);
-        InsertCompareBranch(shortSigIndir, IR::IntConstOpnd::New(expectedSig->GetShortSig(), TyMachReg, m_func), Js::OpCode::BrNeq_A, trapLabel, trapLabel);
-
-        InsertBranch(Js::OpCode::Br, labelFallThrough, trapLabel);
-
-        GenerateThrow(IR::IntConstOpnd::NewFromType(SCODE_CODE(WASMERR_SignatureMismatch), TyInt32, m_func), instr);
+    IR::LabelInstr * trapLabel = InsertLabel(true, instr);
+    IR::LabelInstr * labelFallThrough = InsertLabel(false, instr->m_next);
+    InsertCompareBranch(actualSigKey, IR::IntConstOpnd::New(expectedSig->GetShortSig(), TyMachReg, m_func), Js::OpCode::BrNeq_A, trapLabel, trapLabel);
 
-        instr->Remove();
+    InsertBranch(Js::OpCode::Br, labelFallThrough, trapLabel);
 
-    }
+    GenerateThrow(IR::IntConstOpnd::NewFromType(SCODE_CODE(WASMERR_SignatureMismatch), TyInt32, m_func), instr);
 
+    instr->Remove();
 
     return instrPrev;
 }
@@ -8545,6 +8541,34 @@ Lowerer::LowerGrowWasmMemory(IR::Instr* instr)
 
     return instrPrev;
 }
+
+IR::Instr *
+Lowerer::LowerWasmBulkMemory(IR::Instr* instr, IR::JnHelperMethod helperMethod)
+{
+    // The operands come from an ExtendArg_A chain which ends with the last argument,
+    // that is the order the helper arguments have to be loaded in.
+    IR::Instr * instrPrev = instr->m_prev;
+    IR::Opnd * linkOpnd = instr->UnlinkSrc1();
+    while (linkOpnd)
+    {
+        IR::Instr * argInstr = linkOpnd->AsRegOpnd()->m_sym->m_instrDef;
+        Assert(argInstr->m_opcode == Js::OpCode::ExtendArg_A);
+
+        IR::Opnd * argOpnd = argInstr->GetSrc1()->Copy(m_func);
+        if (argOpnd->IsRegOpnd())
+        {
+            // Keep the argument alive on the back edge until we reach the ExtendArg_A, see LowerFastInlineDOMFastPathGetter
+            this->addToLiveOnBackEdgeSyms->Set(argOpnd->AsRegOpnd()->m_sym->m_id);
+        }
+        m_lowererMD.LoadHelperArgument(instr, argOpnd);
+
+        linkOpnd = argInstr->GetSrc2();
+    }
+
+    m_lowererMD.ChangeToHelperCall(instr, helperMethod);
+
+    return instrPrev;
+}
 #endif
 
 IR::Instr *
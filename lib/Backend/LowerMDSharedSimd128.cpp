@@ -188,6 +188,7 @@ IR::Instr* LowererMD::Simd128LowerUnMappedInstruction(IR::Instr *instr)
     case Js::OpCode::Simd128_ExtractLane_B8:
     case Js::OpCode::Simd128_ExtractLane_B16:
     case Js::OpCode::Simd128_ExtractLane_F4:
+    case Js::OpCode::Simd128_ExtractLane_D2:
         return Simd128LowerLdLane(instr);
 
     case Js::OpCode::Simd128_ReplaceLane_I2:
@@ -492,20 +493,6 @@ IR::Instr* LowererMD::EmitSimdConversion(IR::Instr *instr, IR::JnHelperMethod he
     return removeInstr(instr);
 }
 
-void LowererMD::EmitShiftByScalarI2(IR::Instr *instr, IR::JnHelperMethod helper)
-{
-    IR::Opnd* src2 = instr->GetSrc2();
-    IR::Opnd* dst = instr->GetDst();
-    LoadHelperArgument(instr, src2);
-    IR::MemRefOpnd* srcMemRef = LoadSimdHelperArgument(instr, 0);
-    m_lowerer->InsertMove(srcMemRef, instr->GetSrc1(), instr);
-    IR::MemRefOpnd* dstMemRef = LoadSimdHelperArgument(instr, 1);
-    IR::Instr * helperCall = IR::Instr::New(Js::OpCode::CALL, this->m_func);
-    instr->InsertBefore(helperCall);
-    this->ChangeToHelperCall(helperCall, helper);
-    m_lowerer->InsertMove(dst, dstMemRef, instr);
-}
-
 IR::Instr * LowererMD::SIMD128LowerReplaceLane_2(IR::Instr *instr)
 {
     SList<IR::Opnd*> *args = Simd128GetExtendedArgs(instr);
@@ -648,6 +635,11 @@ IR::Instr* LowererMD::Simd128LowerLdLane(IR::Instr *instr)
     case Js::OpCode::Simd128_ExtractLane_I2:
         laneWidth = 8;
         break;
+    case Js::OpCode::Simd128_ExtractLane_D2:
+        movOpcode = Js::OpCode::MOVSD;
+        Assert(laneIndex < 2);
+        laneWidth = 8;
+        break;
     case Js::OpCode::Simd128_ExtractLane_F4:
         movOpcode = Js::OpCode::MOVSS;
         Assert(laneIndex < 4);
@@ -665,11 +657,17 @@ IR::Instr* LowererMD::Simd128LowerLdLane(IR::Instr *instr)
     case Js::OpCode::Simd128_ExtractLane_I16:
     case Js::OpCode::Simd128_ExtractLane_U16:
     case Js::OpCode::Simd128_ExtractLane_B16:
-        movOpcode = Js::OpCode::MOVD;
         Assert(laneIndex < 16);
+        laneType = TyInt8;
+        if (AutoSystemInfo::Data.SSE4_1Available())
+        {
+            // PEXTRB zero-extends the byte, no shift or mask needed
+            movOpcode = Js::OpCode::PEXTRB;
+            break;
+        }
+        movOpcode = Js::OpCode::MOVD;
         shamt = (laneIndex % 4) * 8;
         laneIndex = laneIndex / 4;
-        laneType = TyInt8;
         mask = 0x000000ff;
         break;
     case Js::OpCode::Simd128_ExtractLane_U4:
@@ -682,10 +680,15 @@ IR::Instr* LowererMD::Simd128LowerLdLane(IR::Instr *instr)
         Assert(UNREACHED);
     }
 
-    if (laneWidth == 8) //Simd128_ExtractLane_I2
+    if (instr->m_opcode == Js::OpCode::Simd128_ExtractLane_I2)
     {
         EmitExtractInt64(dst, instr->GetSrc1(), laneIndex, instr);
     }
+    else if (movOpcode == Js::OpCode::PEXTRB)
+    {
+        // PEXTRB dst, src1, laneIndex
+        instr->InsertBefore(IR::Instr::New(Js::OpCode::PEXTRB, dst, src1, IR::IntConstOpnd::New(laneIndex, TyInt8, m_func, true), m_func));
+    }
     else
     {
         IR::Opnd* tmp = src1;
@@ -732,13 +735,16 @@ IR::Instr* LowererMD::Simd128LowerLdLane(IR::Instr *instr)
                 newInstr = IR::Instr::New(Js::OpCode::MOVSXW, dst, dst->UseWithNewType(laneType, m_func), m_func);
             }
         }
-        else
+        else if (mask != 0)
         {
             newInstr = IR::Instr::New(Js::OpCode::AND, dst, dst, IR::IntConstOpnd::New(mask, TyInt32, m_func), m_func);
         }
 
-        instr->InsertBefore(newInstr);
-        Legalize(newInstr);
+        if (newInstr)
+        {
+            instr->InsertBefore(newInstr);
+            Legalize(newInstr);
+        }
     }
     if (instr->m_opcode == Js::OpCode::Simd128_ExtractLane_B4 || instr->m_opcode == Js::OpCode::Simd128_ExtractLane_B8 ||
         instr->m_opcode == Js::OpCode::Simd128_ExtractLane_B16)
@@ -1108,17 +1114,15 @@ IR::Instr* LowererMD::Simd128LowerShift(IR::Instr *instr)
 
     switch (instr->m_opcode)
     {
-    case Js::OpCode::Simd128_ShRtByScalar_I2:
-        EmitShiftByScalarI2(instr, IR::HelperSimd128ShRtByScalarI2);
-        return removeInstr(instr);
-    case Js::OpCode::Simd128_ShLtByScalar_I2:
-        opcode = Js::OpCode::PSLLQ;
-        elementSizeInBytes = 8;
-        break;
+    case Js::OpCode::Simd128_ShRtByScalar_I2:   // composite, SSE has no 64-bit arithmetic shift
     case Js::OpCode::Simd128_ShRtByScalar_U2:
         opcode = Js::OpCode::PSRLQ;
         elementSizeInBytes = 8;
         break;
+    case Js::OpCode::Simd128_ShLtByScalar_I2:
+        opcode = Js::OpCode::PSLLQ;
+        elementSizeInBytes = 8;
+        break;
     case Js::OpCode::Simd128_ShLtByScalar_I4:
     case Js::OpCode::Simd128_ShLtByScalar_U4:    // same as int32x4.ShiftLeftScalar
         opcode = Js::OpCode::PSLLD;
@@ -1288,6 +1292,24 @@ IR::Instr* LowererMD::Simd128LowerShift(IR::Instr *instr)
         // PAND dst, mask
         instr->InsertBefore(IR::Instr::New(Js::OpCode::PAND, dst, dst, mask, m_func));
     }
+    else if (instr->m_opcode == Js::OpCode::Simd128_ShRtByScalar_I2)
+    {
+        // Sign extend a logical shift: ((x >>> s) ^ m) - m, where m = (1 << 63) >>> s
+        // MOVAPS   tmp1, [X86_NEG_MASK_D2]
+        pInstr = IR::Instr::New(Js::OpCode::MOVAPS, tmp1, IR::MemRefOpnd::New(m_func->GetThreadContextInfo()->GetX86NegMaskD2Addr(), TySimd128I4, m_func), m_func);
+        instr->InsertBefore(pInstr);
+        Legalize(pInstr);
+        // PSRLQ    tmp1, tmp0
+        instr->InsertBefore(IR::Instr::New(Js::OpCode::PSRLQ, tmp1, tmp1, tmp0, m_func));
+        // PSRLQ    dst, src1, tmp0
+        pInstr = IR::Instr::New(Js::OpCode::PSRLQ, dst, src1, tmp0, m_func);
+        instr->InsertBefore(pInstr);
+        Legalize(pInstr);
+        // PXOR     dst, tmp1
+        instr->InsertBefore(IR::Instr::New(Js::OpCode::PXOR, dst, dst, tmp1, m_func));
+        // PSUBQ    dst, tmp1
+        instr->InsertBefore(IR::Instr::New(Js::OpCode::PSUBQ, dst, dst, tmp1, m_func));
+    }
     else
     {
         Assert(UNREACHED);
@@ -1355,33 +1377,51 @@ IR::Instr* LowererMD::SIMD128LowerReplaceLane_16(IR::Instr* instr)
     lane = src2->AsIntConstOpnd()->AsInt32();
     Assert(lane >= 0 && lane < 16);
 
-    IR::Opnd* laneValue = EnregisterIntConst(instr, src3, TyInt8);
-    intptr_t tempSIMD = m_func->GetThreadContextInfo()->GetSimdTempAreaAddr(0);
+    Assert(instr->m_opcode == Js::OpCode::Simd128_ReplaceLane_I16 || instr->m_opcode == Js::OpCode::Simd128_ReplaceLane_U16 || instr->m_opcode == Js::OpCode::Simd128_ReplaceLane_B16);
+    if (AutoSystemInfo::Data.SSE4_1Available())
+    {
+        IR::Opnd* laneValue = EnregisterIntConst(instr, src3);
+
+        // MOVAPS dst, src1
+        newInstr = IR::Instr::New(Js::OpCode::MOVAPS, dst, src1, m_func);
+        instr->InsertBefore(newInstr);
+        Legalize(newInstr);
+
+        // PINSRB dst, value, index
+        newInstr = IR::Instr::New(Js::OpCode::PINSRB, dst, laneValue, IR::IntConstOpnd::New(lane, TyInt8, m_func, true), m_func);
+        instr->InsertBefore(newInstr);
+        Legalize(newInstr);
+    }
+    else
+    {
+        // Without PINSRB, go through memory
+        IR::Opnd* laneValue = EnregisterIntConst(instr, src3, TyInt8);
+        intptr_t tempSIMD = m_func->GetThreadContextInfo()->GetSimdTempAreaAddr(0);
 #if DBG
-    // using only one SIMD temp
-    intptr_t endAddrSIMD = tempSIMD + sizeof(X86SIMDValue);
+        // using only one SIMD temp
+        intptr_t endAddrSIMD = tempSIMD + sizeof(X86SIMDValue);
 #endif
 
-    Assert(instr->m_opcode == Js::OpCode::Simd128_ReplaceLane_I16 || instr->m_opcode == Js::OpCode::Simd128_ReplaceLane_U16 || instr->m_opcode == Js::OpCode::Simd128_ReplaceLane_B16);
-    // MOVUPS [temp], src1
-    intptr_t address = tempSIMD;
-    newInstr = IR::Instr::New(Js::OpCode::MOVUPS, IR::MemRefOpnd::New(address, TySimd128I16, m_func), src1, m_func);
-    instr->InsertBefore(newInstr);
-    Legalize(newInstr);
+        // MOVUPS [temp], src1
+        intptr_t address = tempSIMD;
+        newInstr = IR::Instr::New(Js::OpCode::MOVUPS, IR::MemRefOpnd::New(address, TySimd128I16, m_func), src1, m_func);
+        instr->InsertBefore(newInstr);
+        Legalize(newInstr);
 
-    // MOV [temp+offset], laneValue
-    address = tempSIMD + lane;
-    // check for buffer overrun
-    Assert((intptr_t)address < endAddrSIMD);
-    newInstr = IR::Instr::New(Js::OpCode::MOV, IR::MemRefOpnd::New(address, TyInt8, m_func), laneValue, m_func);
-    instr->InsertBefore(newInstr);
-    Legalize(newInstr);
+        // MOV [temp+offset], laneValue
+        address = tempSIMD + lane;
+        // check for buffer overrun
+        Assert((intptr_t)address < endAddrSIMD);
+        newInstr = IR::Instr::New(Js::OpCode::MOV, IR::MemRefOpnd::New(address, TyInt8, m_func), laneValue, m_func);
+        instr->InsertBefore(newInstr);
+        Legalize(newInstr);
 
-    // MOVUPS dst, [temp]
-    address = tempSIMD;
-    newInstr = IR::Instr::New(Js::OpCode::MOVUPS, dst, IR::MemRefOpnd::New(address, TySimd128I16, m_func), m_func);
-    instr->InsertBefore(newInstr);
-    Legalize(newInstr);
+        // MOVUPS dst, [temp]
+        address = tempSIMD;
+        newInstr = IR::Instr::New(Js::OpCode::MOVUPS, dst, IR::MemRefOpnd::New(address, TySimd128I16, m_func), m_func);
+        instr->InsertBefore(newInstr);
+        Legalize(newInstr);
+    }
 
     if (instr->m_opcode == Js::OpCode::Simd128_ReplaceLane_B16)  //canonicalizing lanes.
     {
@@ -986,6 +986,7 @@ EncoderMD::Encode(IR::Instr *instr, BYTE *pc, BYTE* beginCodeAddress)
                 }
                 break;
             }
+            case Js::OpCode::PEXTRB:
             case Js::OpCode::PEXTRD:
             case Js::OpCode::PEXTRQ:
                 this->EmitModRM(instr, opr1, this->GetRegEncode(opr2->AsRegOpnd()));
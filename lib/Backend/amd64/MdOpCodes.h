@@ -152,9 +152,11 @@ MACRO(PCMPEQW      , Reg2   , None         , RNON , f(MODRM)   , o(PCMPEQW)   ,
 MACRO(PCMPGTB      , Reg2   , None         , RNON , f(MODRM)   , o(PCMPGTB)   , DNO16|DOPEQ|D66             , OLB_0F   , LEGAL_R_R_RM   )
 MACRO(PCMPGTD      , Reg2   , None         , RNON , f(MODRM)   , o(PCMPGTD)   , DNO16|DOPEQ|D66             , OLB_0F   , LEGAL_R_R_RM   )
 MACRO(PCMPGTW      , Reg2   , None         , RNON , f(MODRM)   , o(PCMPGTW)   , DNO16|DOPEQ|D66             , OLB_0F   , LEGAL_R_R_RM   )
+MACRO(PEXTRB       , Reg3   , None         , RNON , f(SPECIAL) , o(PEXTRB)    , DDST|DNO16|DSSE|D66         , OLB_0F3A , LEGAL_RM_R_I   )
 MACRO(PEXTRD       , Reg3   , None         , RNON , f(SPECIAL) , o(PEXTRD)    , DDST|DNO16|DSSE|D66         , OLB_0F3A , LEGAL_RM_R_I   )
 MACRO(PEXTRQ       , Reg3   , None         , RNON , f(SPECIAL) , o(PEXTRQ)    , DDST|DNO16|D66|DREXSRC|DSSE , OLB_0F3A , LEGAL_RM_R_I   )
 MACRO(PEXTRW       , Reg3   , None         , RNON , f(MODRM)   , o(PEXTRW)    , DDST|DNO16|D66|DSSE         , OLB_0F   , LEGAL_RM_R_I   )
+MACRO(PINSRB       , Reg3   , None         , RNON , f(MODRM)   , o(PINSRB)    , DDST|DNO16|DSSE|D66         , OLB_0F3A , LEGAL_R_RM_I   )
 MACRO(PINSRD       , Reg3   , None         , RNON , f(MODRM)   , o(PINSRD)    , DDST|DNO16|DSSE|D66         , OLB_0F3A , LEGAL_R_RM_I   )
 MACRO(PINSRQ       , Reg3   , None         , RNON , f(MODRM)   , o(PINSRQ)    , DDST|DNO16|D66|DREXSRC|DSSE , OLB_0F3A , LEGAL_R_RM_I   )
 MACRO(PINSRW       , Reg2   , None         , RNON , f(MODRM)   , o(PINSRW)    , DDST|DNO16|DSSE|D66         , OLB_0F   , LEGAL_R_RM_I   )
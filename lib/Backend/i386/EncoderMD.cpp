@@ -1146,6 +1146,7 @@ EncoderMD::Encode(IR::Instr *instr, BYTE *pc, BYTE* beginCodeAddress)
                     continue;
                 }
                 break;
+            case Js::OpCode::PEXTRB:
             case Js::OpCode::PEXTRD:
                 this->EmitModRM(instr, opr1, this->GetRegEncode(opr2->AsRegOpnd()));
                 break;
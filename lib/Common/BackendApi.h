@@ -97,6 +97,10 @@ void ProfilePrintNativeCodeGen(NativeCodeGenerator * nativeCodeGen);
 void SetProfilerFromNativeCodeGen(NativeCodeGenerator * toNativeCodeGen, NativeCodeGenerator * fromNativeCodeGen);
 #endif
 
+#ifdef BGJIT_STATS
+void PrintJitPhaseStats();
+#endif
+
 void DeleteNativeCodeData(NativeCodeData * data);
 #else
 inline BOOL IsIntermediateCodeGenThunk(Js::JavascriptMethod codeAddress) { return false; }
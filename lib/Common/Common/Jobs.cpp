@@ -697,7 +697,9 @@ namespace JsUtil
     }
 
     //This function waits on two events jobReady or wakeAllBackgroundThreads
-    //It first waits for 1sec and if it times out it will decommit the allocator and wait infinitely.
+    //It first waits for 1sec and if it times out it will release the per-thread job state back to the allocator.
+    //The allocator's free pages are kept committed for BgJobPageCacheTimeout more, so that the arenas of the next
+    //burst of jobs don't have to fault their pages in again; after that it decommits the allocator and waits infinitely.
     bool BackgroundJobProcessor::WaitForJobReadyOrShutdown(ParallelThreadData *threadData)
     {
         const HANDLE handles[] = { jobReady.Handle(), wakeAllBackgroundThreads.Handle() };
@@ -713,13 +715,18 @@ namespace JsUtil
         {
             if (threadData->CanDecommit())
             {
-                // If its 1sec time out decommit and wait for INFINITE
-                threadData->backgroundPageAllocator.DecommitNow();
+                // If its 1sec time out release the job state; the freed pages stay in the allocator (up to its max free page count)
                 this->ForEachManager([&](JobManager *manager){
                     manager->OnDecommit(threadData);
                 });
 
-                result = WaitForMultipleObjectsEx(_countof(handles), handles, false, INFINITE, false);
+                result = WaitForMultipleObjectsEx(_countof(handles), handles, false, CONFIG_FLAG(BgJobPageCacheTimeout), false);
+                if (result == WAIT_TIMEOUT)
+                {
+                    // Still idle, decommit and wait for INFINITE
+                    threadData->backgroundPageAllocator.DecommitNow();
+                    result = WaitForMultipleObjectsEx(_countof(handles), handles, false, INFINITE, false);
+                }
             }
             else
             {
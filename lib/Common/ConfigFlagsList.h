@@ -428,6 +428,11 @@ PHASE(All)
     #define DEFAULT_CONFIG_WasmFastArray    (false)
 #endif
 #define DEFAULT_CONFIG_WasmSharedArrayVirtualBuffer (true)
+#if TARGET_64
+    #define DEFAULT_CONFIG_WasmReserveMemory    (true)
+#else
+    #define DEFAULT_CONFIG_WasmReserveMemory    (false)
+#endif
 #define DEFAULT_CONFIG_WasmCheckVersion     (true)
 #define DEFAULT_CONFIG_WasmAssignModuleID   (false)
 #define DEFAULT_CONFIG_WasmIgnoreLimits     (false)
@@ -439,6 +444,7 @@ PHASE(All)
 #define DEFAULT_CONFIG_WasmMultiValue       (false)
 #define DEFAULT_CONFIG_WasmSignExtends      (true)
 #define DEFAULT_CONFIG_WasmNontrapping      (true)
+#define DEFAULT_CONFIG_WasmBulkMemory       (true)
 #define DEFAULT_CONFIG_WasmExperimental     (false)
 #define DEFAULT_CONFIG_BgParse              (false)
 #define DEFAULT_CONFIG_BgJitDelayFgBuffer   (0)
@@ -521,6 +527,7 @@ PHASE(All)
 
 #define DEFAULT_CONFIG_MaxJitThreadCount        (2)
 #define DEFAULT_CONFIG_ForceMaxJitThreadCount   (false)
+#define DEFAULT_CONFIG_BgJobPageCacheTimeout    (10000)
 
 #define DEFAULT_CONFIG_MitigateSpectre (true)
 
@@ -800,6 +807,7 @@ PHASE(All)
 #endif
 
 #define DEFAULT_CONFIG_RecyclerForceMarkInterior (false)
+#define DEFAULT_CONFIG_MinParallelWeakRefSweep (0x8000)
 
 #define DEFAULT_CONFIG_MemProtectHeap (false)
 
@@ -952,6 +960,7 @@ FLAGNR(Boolean, Wasm                  , "Enable WebAssembly", DEFAULT_CONFIG_Was
 FLAGNR(Boolean, WasmI64               , "Enable Int64 testing for WebAssembly. ArgIns can be [number,string,{low:number,high:number}]. Return values will be {low:number,high:number}", DEFAULT_CONFIG_WasmI64)
 FLAGNR(Boolean, WasmFastArray         , "Enable fast array implementation for WebAssembly", DEFAULT_CONFIG_WasmFastArray)
 FLAGNR(Boolean, WasmSharedArrayVirtualBuffer, "Use Virtual allocation for WebAssemblySharedArrayBuffer (Windows only)", DEFAULT_CONFIG_WasmSharedArrayVirtualBuffer)
+FLAGNR(Boolean, WasmReserveMemory     , "Reserve address space for WebAssembly memories so they grow without copying: up to the declared maximum, or doubling as they grow without one (when WasmFastArray is off)", DEFAULT_CONFIG_WasmReserveMemory)
 FLAGNR(Boolean, WasmMathExFilter      , "Enable Math exception filter for WebAssembly", DEFAULT_CONFIG_WasmMathExFilter)
 FLAGNR(Boolean, WasmCheckVersion      , "Check the binary version for WebAssembly", DEFAULT_CONFIG_WasmCheckVersion)
 FLAGNR(Boolean, WasmAssignModuleID    , "Assign an individual ID for WebAssembly module", DEFAULT_CONFIG_WasmAssignModuleID)
@@ -963,6 +972,7 @@ FLAGNR(Boolean, WasmThreads           , "Enable WebAssembly threads feature", DE
 FLAGNR(Boolean, WasmMultiValue        , "Use new WebAssembly multi-value", DEFAULT_CONFIG_WasmMultiValue)
 FLAGNR(Boolean, WasmSignExtends       , "Use new WebAssembly sign extension operators", DEFAULT_CONFIG_WasmSignExtends)
 FLAGNR(Boolean, WasmNontrapping, "Enable non-trapping float-to-int conversions in WebAssembly", DEFAULT_CONFIG_WasmNontrapping)
+FLAGNR(Boolean, WasmBulkMemory        , "Enable WebAssembly bulk memory operators and passive data segments", DEFAULT_CONFIG_WasmBulkMemory)
 
 // WebAssembly Experimental Features
 // Master WasmExperimental flag to activate WebAssembly experimental features
@@ -1311,6 +1321,7 @@ FLAGNR(Number,  LoopBodySizeThresholdToDisableOpts, "Minimum bytecode size of a
 
 FLAGNR(Number,  MaxJitThreadCount     , "Number of maximum allowed parallel jit threads (actual number is factor of number of processors and other heuristics)", DEFAULT_CONFIG_MaxJitThreadCount)
 FLAGNR(Boolean, ForceMaxJitThreadCount, "Force the number of parallel jit threads as specified by MaxJitThreadCount flag (creation guaranteed)", DEFAULT_CONFIG_ForceMaxJitThreadCount)
+FLAGNR(Number,  BgJobPageCacheTimeout , "Milliseconds an idle background job thread keeps its free pages committed for the next job before decommitting them", DEFAULT_CONFIG_BgJobPageCacheTimeout)
 
 FLAGR(Boolean, MitigateSpectre, "Use mitigations for Spectre", DEFAULT_CONFIG_MitigateSpectre)
 
@@ -1459,6 +1470,7 @@ FLAGNR(Boolean, RecyclerTrackStress, "Stress tracked object handling by simulati
 FLAGNR(Boolean, RecyclerInduceFalsePositives, "Stress recycler by forcing false positive object marks", false)
 #endif // RECYCLER_STRESS
 FLAGNR(Boolean, RecyclerForceMarkInterior, "Force all the mark as interior", DEFAULT_CONFIG_RecyclerForceMarkInterior)
+FLAGNR(Number,  MinParallelWeakRefSweep, "Minimum number of weak references before they are swept on the parallel mark threads", DEFAULT_CONFIG_MinParallelWeakRefSweep)
 #if ENABLE_CONCURRENT_GC
 FLAGNR(Number,  RecyclerPriorityBoostTimeout, "Adjust priority boost timeout", 5000)
 FLAGNR(Number,  RecyclerThreadCollectTimeout, "Adjust thread collect timeout", 1000)
@@ -63,6 +63,11 @@ class AllocationPolicyManager
         return memoryLimit;
     }
 
+    bool SupportsConcurrency() const
+    {
+        return supportConcurrency;
+    }
+
     void SetLimit(size_t newLimit)
     {
         memoryLimit = newLimit;
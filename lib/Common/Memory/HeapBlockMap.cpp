@@ -944,10 +944,16 @@ HeapBlockMap32::Rescan(Recycler * recycler, bool resetWriteWatch)
 #ifdef RECYCLER_WRITE_BARRIER
         if (recycler->autoHeap.IsRecyclerWithBarrierPageAllocator(segmentPageAllocator))
         {
-            // Loop through pages for this segment and check write barrier.
+            // Loop through the dirty pages for this segment, skipping runs of clean cards at once.
             size_t pageCount = segmentLength / AutoSystemInfo::PageSize;
             for (size_t i = 0; i < pageCount; i++)
             {
+                i += RecyclerWriteBarrierManager::FindFirstDirtyPage(segmentStart + (i * AutoSystemInfo::PageSize), pageCount - i);
+                if (i == pageCount)
+                {
+                    break;
+                }
+
                 char * pageAddress = segmentStart + (i * AutoSystemInfo::PageSize);
                 Assert((size_t)(pageAddress - segmentStart) < segmentLength);
 
@@ -958,16 +964,12 @@ HeapBlockMap32::Rescan(Recycler * recycler, bool resetWriteWatch)
                 // TODO: We are not resetting the write barrier here when RescanFlags_ResetWriteWatch is passed.
                 // We never have previously, but it still seems like we should.
 
-                BYTE writeBarrierByte = RecyclerWriteBarrierManager::GetWriteBarrier(pageAddress);
-                SwbVerboseTrace(recycler->GetRecyclerFlagsTable(), _u("Address: 0x%p, Write Barrier value: %u\n"), pageAddress, writeBarrierByte);
-                bool isDirty = (writeBarrierByte & DIRTYBIT);
+                SwbVerboseTrace(recycler->GetRecyclerFlagsTable(), _u("Address: 0x%p, Write Barrier value: %u\n"), pageAddress, RecyclerWriteBarrierManager::GetWriteBarrier(pageAddress));
+                Assert((RecyclerWriteBarrierManager::GetWriteBarrier(pageAddress) & DIRTYBIT) == DIRTYBIT);
 
-                if (isDirty)
+                if (RescanPage(pageAddress, &anyObjectsScannedOnPage, recycler) && anyObjectsScannedOnPage)
                 {
-                    if (RescanPage(pageAddress, &anyObjectsScannedOnPage, recycler) && anyObjectsScannedOnPage)
-                    {
-                        scannedPageCount++;
-                    }
+                    scannedPageCount++;
                 }
             }
             return;
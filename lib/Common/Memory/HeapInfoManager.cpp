@@ -44,6 +44,9 @@ HeapInfoManager::HeapInfoManager(AllocationPolicyManager * policyManager, Js::Co
 #endif
     uncollectedAllocBytes(0),
     lastUncollectedAllocBytes(0),
+    uncollectedExternalBytes(0),
+    uncollectedHostExternalBytes(0),
+    lastUncollectedHostExternalBytes(0),
     pendingZeroPageCount(0)
 {
 }
@@ -204,6 +204,9 @@ class HeapInfoManager
     size_t uncollectedAllocBytes;
     size_t lastUncollectedAllocBytes;
     size_t uncollectedExternalBytes;
+    // Only what the host reported through JsAdjustExternalMemory, not array buffer contents
+    size_t uncollectedHostExternalBytes;
+    size_t lastUncollectedHostExternalBytes;
     uint pendingZeroPageCount;
 #if ENABLE_PARTIAL_GC
     size_t uncollectedNewPageCount;
@@ -606,6 +606,12 @@ LargeHeapBlock::Alloc(DECLSPEC_GUARD_OVERFLOW size_t size, ObjectInfoBits attrib
     AssertMsg((attributes & TrackBit) == 0, "Large tracked object collection not implemented");
 #endif
 
+    // Blocks on a dedicated segment only hold one object, no matter how much space is left
+    if (allocCount == objectCount)
+    {
+        return nullptr;
+    }
+
     LargeObjectHeader * header = (LargeObjectHeader *)allocAddressEnd;
 #if ENABLE_PARTIAL_GC && ENABLE_CONCURRENT_GC
     Assert(!IsPartialSweptHeader(header));
@@ -1557,6 +1563,14 @@ LargeHeapBlock::RescanMultiPage(Recycler * recycler)
                 if (!isLastPageCheckedForWriteWatchDirty)
                 {
                     objectAddress = pageStart + AutoSystemInfo::PageSize;
+#ifdef RECYCLER_WRITE_BARRIER
+                    if (header->hasWriteBarrier && objectAddress < objectAddressEnd)
+                    {
+                        // Checking the card table has no side effect, skip the whole run of clean pages
+                        const size_t remainingPageCount = Math::Align<size_t>(objectAddressEnd - objectAddress, AutoSystemInfo::PageSize) / AutoSystemInfo::PageSize;
+                        objectAddress += RecyclerWriteBarrierManager::FindFirstDirtyPage(objectAddress, remainingPageCount) * AutoSystemInfo::PageSize;
+                    }
+#endif
                     continue;
                 }
 
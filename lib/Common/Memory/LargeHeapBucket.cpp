@@ -320,7 +320,12 @@ LargeHeapBucket::AddLargeHeapBlock(size_t size, bool nothrow)
 #ifdef RECYCLER_ZERO_MEM_CHECK
     recycler->VerifyZeroFill(address, pageCount * AutoSystemInfo::PageSize);
 #endif
-    uint objectCount = LargeHeapBlock::GetMaxLargeObjectCount(pageCount, size);
+
+    // An allocation too big for a page segment gets a segment of its own. Don't let other objects
+    // share its tail so that the segment is released back to the OS as soon as the object dies.
+    // Fresh segments are already zeroed, so the object doesn't need to be cleared either.
+    bool isDedicatedSegment = pageCount > heapInfo->GetRecyclerLargeBlockPageAllocator()->GetMaxAllocPageCount();
+    uint objectCount = isDedicatedSegment ? 1 : LargeHeapBlock::GetMaxLargeObjectCount(pageCount, size);
     LargeHeapBlock * heapBlock = LargeHeapBlock::New(address, pageCount, segment, objectCount, this);
 #if DBG
     LargeAllocationVerboseTrace(recycler->GetRecyclerFlagsTable(), _u("Allocated new large heap block 0x%p for sizeCat 0x%x\n"), heapBlock, sizeCat);
@@ -705,6 +705,9 @@ PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::PageAllocatorBase(Allo
     , reservedBytes(0)
     , committedBytes(0)
     , usedBytes(0)
+#ifdef BGJIT_STATS
+    , peakUsedBytes(0)
+#endif
     , numberOfSegments(0)
     , processHandle(processHandle)
     , enableWriteBarrier(enableWriteBarrier)
@@ -2258,6 +2261,12 @@ void
 PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::AddUsedBytes(size_t bytes)
 {
     usedBytes += bytes;
+#ifdef BGJIT_STATS
+    if (usedBytes > peakUsedBytes)
+    {
+        peakUsedBytes = usedBytes;
+    }
+#endif
 #if defined(TARGET_64)
     size_t lastTotalUsedBytes = ::InterlockedExchangeAdd64((volatile LONG64 *)&totalUsedBytes, bytes);
 #else
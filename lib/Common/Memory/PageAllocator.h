@@ -926,6 +926,9 @@ class PageAllocatorBase: public PageAllocatorBaseCommon
 #endif
 
     size_t usedBytes;
+#ifdef BGJIT_STATS
+    size_t peakUsedBytes;
+#endif
     PageAllocatorType type;
 
     size_t reservedBytes;
@@ -972,6 +975,11 @@ class PageAllocatorBase: public PageAllocatorBaseCommon
     size_t GetCommittedBytes() const { return this->committedBytes; }
     size_t GetUsedBytes() const { return this->usedBytes; }
     size_t GetNumberOfSegments() const { return this->numberOfSegments; }
+#ifdef BGJIT_STATS
+    // High-water mark of usedBytes since the last reset; used to attribute peak arena usage to JIT phases
+    size_t GetPeakUsedBytes() const { return this->peakUsedBytes; }
+    void SetPeakUsedBytes(size_t bytes) { this->peakUsedBytes = max(bytes, this->usedBytes); }
+#endif
 
 private:
 
@@ -298,6 +298,10 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
 #endif
 
     this->inDispose = false;
+    this->externalStackCount = 0;
+    this->externalStackScanId = 0;
+    this->scanningExternalStack = nullptr;
+    this->hostExternalBytes = 0;
 
 #if DBG
     this->heapBlockCount = 0;
@@ -543,6 +547,9 @@ Recycler::~Recycler()
     clientTrackedObjectList.Clear(&this->clientTrackedObjectAllocator);
 #endif
 
+    // Hosts are expected to unregister their stacks, but don't leak the nodes if they didn't
+    externalStackList.Clear(&NoThrowHeapAllocator::Instance);
+
 #ifdef PROFILE_RECYCLER_ALLOC
     if (trackerDictionary != nullptr)
     {
@@ -1033,6 +1040,33 @@ Recycler::AddExternalMemoryUsage(size_t size)
     CollectNow<CollectOnAllocation>();
 }
 
+void
+Recycler::AddHostExternalMemoryUsage(size_t size)
+{
+    {
+        AutoCriticalSection autoCS(&this->hostExternalMemoryLock);
+        this->hostExternalBytes += size;
+    }
+    this->autoHeap.uncollectedHostExternalBytes += size;
+    AddExternalMemoryUsage(size);
+}
+
+// Returns false, without releasing anything, if the host releases more than it has reported
+bool
+Recycler::ReleaseHostExternalMemory(size_t size)
+{
+    {
+        AutoCriticalSection autoCS(&this->hostExternalMemoryLock);
+        if (size > this->hostExternalBytes)
+        {
+            return false;
+        }
+        this->hostExternalBytes -= size;
+    }
+    ReportExternalMemoryFree(size);
+    return true;
+}
+
 bool Recycler::RequestExternalMemoryAllocation(size_t size)
 {
     AllocationPolicyManager * allocationPolicyManager = autoHeap.GetAllocationPolicyManager();
@@ -1779,6 +1813,180 @@ Recycler::ScanStack()
 }
 #pragma warning(pop)
 
+Recycler::ExternalStack *
+Recycler::RegisterExternalStack(void * stackTop, void * stackBase)
+{
+    Assert(stackTop < stackBase);
+
+    AutoCriticalSection autoCS(&this->externalStackListLock);
+    ExternalStack * externalStack = this->externalStackList.PrependNode(&NoThrowHeapAllocator::Instance);
+    if (externalStack != nullptr)
+    {
+        externalStack->stackTop = stackTop;
+        externalStack->stackBase = stackBase;
+        externalStack->isPinned = false;
+        externalStack->isUnregistered = false;
+
+        // Not scanned yet, even if a collection is already in progress
+        externalStack->scanId = this->externalStackScanId - 1;
+        this->externalStackCount++;
+    }
+    return externalStack;
+}
+
+// Returns false if the handle isn't registered with this recycler (e.g. it belongs to another
+// runtime or was already unregistered)
+bool
+Recycler::UnregisterExternalStack(ExternalStack * externalStack)
+{
+    {
+        AutoCriticalSection autoCS(&this->externalStackListLock);
+        if (!IsExternalStackRegistered(externalStack))
+        {
+            return false;
+        }
+
+        if (!externalStack->isPinned)
+        {
+            RemoveExternalStack(externalStack);
+            return true;
+        }
+
+        // A scan holds on to the node, it removes it once it is done with it
+        externalStack->isUnregistered = true;
+        if (this->scanningExternalStack != externalStack)
+        {
+            return true;
+        }
+    }
+
+    // The host may reuse the stack as soon as we return, wait for the scan to move past it.
+    // Only this stack is waited on, not the rest of the scan.
+    while (true)
+    {
+        {
+            AutoCriticalSection autoCS(&this->externalStackListLock);
+            if (this->scanningExternalStack != externalStack)
+            {
+                return true;
+            }
+        }
+        Sleep(0);
+    }
+}
+
+bool
+Recycler::IsExternalStackRegistered(ExternalStack * externalStack) const
+{
+    Assert(this->externalStackListLock.IsLocked());
+
+    // Only a handful of stacks are expected to be registered at a time
+    DListBase<ExternalStack>::Iterator iter(&this->externalStackList);
+    while (iter.Next())
+    {
+        ExternalStack const& current = iter.Data();
+        if (&current == externalStack)
+        {
+            return !current.isUnregistered;
+        }
+    }
+    return false;
+}
+
+void
+Recycler::RemoveExternalStack(ExternalStack * externalStack)
+{
+    Assert(this->externalStackListLock.IsLocked());
+    Assert(!externalStack->isPinned);
+    this->externalStackList.RemoveElement(&NoThrowHeapAllocator::Instance, externalStack);
+    this->externalStackCount--;
+}
+
+size_t
+Recycler::ScanExternalStacks()
+{
+    size_t scannedBytes = 0;
+    ExternalStack ** snapshot = nullptr;
+    uint snapshotCapacity = 0;
+    uint snapshotCount = 0;
+
+    {
+        AutoCriticalSection autoCS(&this->externalStackListLock);
+        Assert(this->scanningExternalStack == nullptr);
+        if (this->externalStackCount == 0)
+        {
+            return 0;
+        }
+
+        // Snapshot the stacks that still need a scan in this collection and scan them outside the lock,
+        // so the host doesn't stall registering or unregistering stacks while we scan
+        snapshotCapacity = this->externalStackCount;
+        snapshot = HeapNewNoThrowArray(ExternalStack *, snapshotCapacity);
+        DListBase<ExternalStack>::Iterator externalStackIter(&this->externalStackList);
+        while (externalStackIter.Next())
+        {
+            ExternalStack& externalStack = externalStackIter.Data();
+            if (externalStack.scanId == this->externalStackScanId || externalStack.isUnregistered)
+            {
+                // A registered stack can't change, so a scan done earlier during this collection is still good
+                continue;
+            }
+            externalStack.scanId = this->externalStackScanId;
+
+            if (snapshot == nullptr)
+            {
+                // Out of memory for the snapshot, scan in place under the lock
+                size_t byteCount = (char *)externalStack.stackBase - (char *)externalStack.stackTop;
+                ScanMemoryInline<false, true /* forceInterior */>((void **)externalStack.stackTop, byteCount
+                    ADDRESS_SANITIZER_APPEND(RecyclerScanMemoryType::Stack));
+                scannedBytes += byteCount;
+                continue;
+            }
+
+            externalStack.isPinned = true;
+            snapshot[snapshotCount++] = &externalStack;
+        }
+    }
+
+    for (uint i = 0; i < snapshotCount; i++)
+    {
+        ExternalStack * externalStack = snapshot[i];
+        {
+            AutoCriticalSection autoCS(&this->externalStackListLock);
+            if (externalStack->isUnregistered)
+            {
+                // Unregistered before we got to it, the host may already be reusing the stack
+                externalStack->isPinned = false;
+                RemoveExternalStack(externalStack);
+                continue;
+            }
+            this->scanningExternalStack = externalStack;
+        }
+
+        // Like the script thread's stack, a suspended stack may hold interior pointers to string buffers
+        size_t byteCount = (char *)externalStack->stackBase - (char *)externalStack->stackTop;
+        ScanMemoryInline<false, true /* forceInterior */>((void **)externalStack->stackTop, byteCount
+            ADDRESS_SANITIZER_APPEND(RecyclerScanMemoryType::Stack));
+        scannedBytes += byteCount;
+
+        {
+            AutoCriticalSection autoCS(&this->externalStackListLock);
+            this->scanningExternalStack = nullptr;
+            externalStack->isPinned = false;
+            if (externalStack->isUnregistered)
+            {
+                RemoveExternalStack(externalStack);
+            }
+        }
+    }
+
+    if (snapshot != nullptr)
+    {
+        HeapDeleteArray(snapshotCapacity, snapshot);
+    }
+    return scannedBytes;
+}
+
 template <bool background>
 size_t Recycler::ScanPinnedObjects()
 {
@@ -1946,6 +2154,8 @@ Recycler::FindRoots()
     }
     RECYCLER_PROFILE_EXEC_END(this, Js::FindRootArenaPhase);
 
+    scanRootBytes += ScanExternalStacks();
+
     this->ScanImplicitRoots();
 
     RECYCLER_PROFILE_EXEC_END(this, Js::FindRootPhase);
@@ -2071,6 +2281,10 @@ Recycler::ResetMarks(ResetMarkFlags flags)
     Assert(IsMarkStackEmpty());
     this->scanPinnedObjectMap = true;
     this->hasScannedInitialImplicitRoots = false;
+    {
+        AutoCriticalSection autoCS(&this->externalStackListLock);
+        this->externalStackScanId++;
+    }
 
     heapBlockMap.ResetMarks();
 
@@ -2375,6 +2589,8 @@ Recycler::ResetHeuristicCounters()
     autoHeap.lastUncollectedAllocBytes = autoHeap.uncollectedAllocBytes;
     autoHeap.uncollectedAllocBytes = 0;
     autoHeap.uncollectedExternalBytes = 0;
+    autoHeap.lastUncollectedHostExternalBytes = autoHeap.uncollectedHostExternalBytes;
+    autoHeap.uncollectedHostExternalBytes = 0;
     ResetPartialHeuristicCounters();
 }
 
@@ -3129,42 +3345,132 @@ void Recycler::DisplayMemStats()
 
 CollectedRecyclerWeakRefHeapBlock CollectedRecyclerWeakRefHeapBlock::Instance;
 
+bool
+Recycler::SweepWeakReferenceEntry(RecyclerWeakReferenceBase * weakRef, bool * hasCleanup)
+{
+    if (!weakRef->weakRefHeapBlock->TestObjectMarkedBit(weakRef))
+    {
+        *hasCleanup = true;
+
+        // Remove
+        return false;
+    }
+
+    if (!weakRef->strongRefHeapBlock->TestObjectMarkedBit(weakRef->strongRef))
+    {
+        *hasCleanup = true;
+        weakRef->strongRef = nullptr;
+
+        // Put in a dummy heap block so that we can still do the isPendingConcurrentSweep check first.
+        weakRef->strongRefHeapBlock = &CollectedRecyclerWeakRefHeapBlock::Instance;
+
+        // Remove
+        return false;
+    }
+
+    return true;
+}
+
+#if ENABLE_CONCURRENT_GC
+void
+Recycler::SweepWeakReferenceShard(WeakReferenceSweepShard * shard)
+{
+    bool hasCleanup = false;
+    shard->removedCount = weakReferenceMap.MapBucketRange(shard->startBucket, shard->endBucket, [&hasCleanup](RecyclerWeakReferenceBase * weakRef) -> bool
+    {
+        return SweepWeakReferenceEntry(weakRef, &hasCleanup);
+    });
+    shard->hasCleanup = hasCleanup;
+}
+
+bool
+Recycler::ParallelSweepWeakReferenceMap()
+{
+    // Only the mark bits are read here, and each shard owns a disjoint set of bucket chains,
+    // so the shards can be swept on the parallel mark threads without any locking.
+    const uint shardCount = min(this->maxParallelism, (uint)_countof(weakReferenceSweepShards));
+    const uint bucketCount = weakReferenceMap.GetBucketCount();
+    Assert(shardCount >= 2);
+
+    for (uint i = 0; i < shardCount; i++)
+    {
+        WeakReferenceSweepShard& shard = weakReferenceSweepShards[i];
+        shard.startBucket = (uint)((uint64)bucketCount * i / shardCount);
+        shard.endBucket = (uint)((uint64)bucketCount * (i + 1) / shardCount);
+        shard.removedCount = 0;
+        shard.hasCleanup = false;
+    }
+
+    // If the threads haven't been created yet, this will create them (or fail).
+    bool parallelSuccess1 = parallelThread1.StartConcurrent();
+    bool parallelSuccess2 = false;
+    if (parallelSuccess1 && shardCount == 3)
+    {
+        parallelSuccess2 = parallelThread2.StartConcurrent();
+    }
+
+    // Process our portion of the map.
+    this->SweepWeakReferenceShard(&weakReferenceSweepShards[0]);
+
+    // If we failed to launch parallel work, process the shard in-thread now.
+    if (parallelSuccess1)
+    {
+        parallelThread1.WaitForConcurrent();
+    }
+    else
+    {
+        this->SweepWeakReferenceShard(&weakReferenceSweepShards[1]);
+    }
+
+    if (shardCount == 3)
+    {
+        if (parallelSuccess2)
+        {
+            parallelThread2.WaitForConcurrent();
+        }
+        else
+        {
+            this->SweepWeakReferenceShard(&weakReferenceSweepShards[2]);
+        }
+    }
+
+    bool hasCleanup = false;
+    uint removedCount = 0;
+    for (uint i = 0; i < shardCount; i++)
+    {
+        hasCleanup |= weakReferenceSweepShards[i].hasCleanup;
+        removedCount += weakReferenceSweepShards[i].removedCount;
+    }
+    weakReferenceMap.OnEntriesRemoved(removedCount);
+    return hasCleanup;
+}
+#endif
+
 void
 Recycler::SweepWeakReference()
 {
     RECYCLER_PROFILE_EXEC_BEGIN(this, Js::SweepWeakPhase);
     GCETW(GC_SWEEP_WEAKREF_START, (this));
 
-    // REVIEW: Clean up the weak reference map concurrently?
     bool hasCleanup = false;
 #if defined(GCETW) && defined(ENABLE_JS_ETW)
     uint scannedCount = weakReferenceMap.Count();
 #endif
 
-    weakReferenceMap.Map([&hasCleanup](RecyclerWeakReferenceBase * weakRef) -> bool
+#if ENABLE_CONCURRENT_GC
+    // Hosts can hold a very large number of weak references; split the map across the parallel mark threads
+    if (this->enableParallelMark && weakReferenceMap.Count() >= (uint)CUSTOM_CONFIG_FLAG(GetRecyclerFlagsTable(), MinParallelWeakRefSweep))
     {
-        if (!weakRef->weakRefHeapBlock->TestObjectMarkedBit(weakRef))
-        {
-            hasCleanup = true;
-
-            // Remove
-            return false;
-        }
-
-        if (!weakRef->strongRefHeapBlock->TestObjectMarkedBit(weakRef->strongRef))
+        hasCleanup = this->ParallelSweepWeakReferenceMap();
+    }
+    else
+#endif
+    {
+        weakReferenceMap.Map([&hasCleanup](RecyclerWeakReferenceBase * weakRef) -> bool
         {
-            hasCleanup = true;
-            weakRef->strongRef = nullptr;
-
-            // Put in a dummy heap block so that we can still do the isPendingConcurrentSweep check first.
-            weakRef->strongRefHeapBlock = &CollectedRecyclerWeakRefHeapBlock::Instance;
-
-            // Remove
-            return false;
-        }
-
-        return true;
-    });
+            return SweepWeakReferenceEntry(weakRef, &hasCleanup);
+        });
+    }
 
 #if defined(GCETW) && defined(ENABLE_JS_ETW)
     uint regionScannedCount = 0;
@@ -5540,6 +5846,10 @@ Recycler::BackgroundResetMarks()
     Assert(IsMarkStackEmpty());
     this->scanPinnedObjectMap = true;
     this->hasScannedInitialImplicitRoots = false;
+    {
+        AutoCriticalSection autoCS(&this->externalStackListLock);
+        this->externalStackScanId++;
+    }
 
     heapBlockMap.ResetMarks();
 
@@ -5642,6 +5952,9 @@ Recycler::BackgroundFindRoots()
     }
     RECYCLER_PROFILE_EXEC_BACKGROUND_END(this, Js::FindRootArenaPhase);
 
+    // Suspended stacks registered by the host don't need to wait for the in-thread root scan
+    scanRootBytes += ScanExternalStacks();
+
     this->ScanImplicitRoots();
 
     RECYCLER_PROFILE_EXEC_BACKGROUND_END(this, Js::BackgroundFindRootsPhase);
@@ -6923,6 +7236,12 @@ Recycler::ParallelWorkFunc()
             this->ProcessParallelMark(true, markContext);
             break;
 
+        case CollectionStateSweep:
+        case CollectionStateSetupConcurrentSweep:
+            // Weak reference map shards 1 and 2; shard 0 is swept by the main thread
+            this->SweepWeakReferenceShard(&this->weakReferenceSweepShards[parallelId + 1]);
+            break;
+
         default:
             Assert(false);
     }
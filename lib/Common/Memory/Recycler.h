@@ -802,6 +802,30 @@ class Recycler
     DListBase<GuestArenaAllocator> guestArenaList;
     DListBase<ArenaData*> externalGuestArenaList;    // guest arenas are scanned for roots
 
+public:
+    // A suspended fiber or coroutine stack registered by the host. Its contents can't change
+    // while it is registered, so it is scanned once per collection, in the background when possible.
+    struct ExternalStack
+    {
+        void * stackTop;
+        void * stackBase;
+        uint scanId;
+        // In the snapshot of a scan in progress, the node stays in the list until the scan is done with it
+        bool isPinned;
+        bool isUnregistered;
+    };
+private:
+    DListBase<ExternalStack> externalStackList;
+    CriticalSection externalStackListLock;
+    uint externalStackCount;
+    uint externalStackScanId;
+    ExternalStack * scanningExternalStack;
+
+    // External memory reported by the host that hasn't been released yet. Releases can come from
+    // the background finalizer thread, hence the lock.
+    CriticalSection hostExternalMemoryLock;
+    size_t hostExternalBytes;
+
 #ifdef RECYCLER_PAGE_HEAP
     bool isPageHeapEnabled;
     bool capturePageHeapAllocStack;
@@ -990,6 +1014,16 @@ class Recycler
     RecyclerParallelThread parallelThread1;
     RecyclerParallelThread parallelThread2;
 
+    // Bucket ranges of the weak reference map swept by the main thread and the two parallel threads
+    struct WeakReferenceSweepShard
+    {
+        uint startBucket;
+        uint endBucket;
+        uint removedCount;
+        bool hasCleanup;
+    };
+    WeakReferenceSweepShard weakReferenceSweepShards[3];
+
 #if DBG
     // Variable indicating if the concurrent thread has exited or not
     // If the concurrent thread hasn't started yet, this is set to true
@@ -1242,6 +1276,9 @@ class Recycler
         this->CollectNow<CollectExhaustiveCandidate>();
     }
 
+    ExternalStack * RegisterExternalStack(void * stackTop, void * stackBase);
+    bool UnregisterExternalStack(ExternalStack * externalStack);
+
 #ifdef RECYCLER_TEST_SUPPORT
     void SetCheckFn(BOOL(*checkFn)(char* addr, size_t size));
 #endif
@@ -1257,6 +1294,8 @@ class Recycler
 #endif
 
     void AddExternalMemoryUsage(size_t size);
+    void AddHostExternalMemoryUsage(size_t size);
+    bool ReleaseHostExternalMemory(size_t size);
 
     bool NeedDispose() { return this->hasDisposableObject; }
 
@@ -1578,6 +1617,9 @@ class Recycler
     template <bool background>
     size_t ScanPinnedObjects();
     size_t ScanStack();
+    size_t ScanExternalStacks();
+    bool IsExternalStackRegistered(ExternalStack * externalStack) const;
+    void RemoveExternalStack(ExternalStack * externalStack);
     size_t ScanArena(ArenaData * alloc, bool background);
     void ScanImplicitRoots();
     void ScanInitialImplicitRoots();
@@ -1650,6 +1692,11 @@ class Recycler
     bool Sweep(bool concurrent = false);
 #endif
     void SweepWeakReference();
+    static bool SweepWeakReferenceEntry(RecyclerWeakReferenceBase * weakRef, bool * hasCleanup);
+#if ENABLE_CONCURRENT_GC
+    bool ParallelSweepWeakReferenceMap();
+    void SweepWeakReferenceShard(WeakReferenceSweepShard * shard);
+#endif
     void SweepHeap(bool concurrent, RecyclerSweepManager& recyclerSweepManager);
     void FinishSweep(RecyclerSweepManager& recyclerSweepManager);
 
@@ -27,6 +27,10 @@ class RecyclerHeuristic
     // If we are getting close to the full GC limit, let's just get out of partial GC mode.
     uint   MaxUncollectedAllocBytesPartialCollect;
 
+    // External memory is only released when the objects holding it are collected. If this much was
+    // reported since the last GC, don't get into partial GC mode, so that old holders get collected too.
+    uint   MaxUncollectedExternalBytesPartialCollect;
+
     // Defines the PageSegment size for recycler small block page allocator.
     uint DefaultMaxAllocPageCount;
 
@@ -403,6 +403,13 @@ RecyclerSweepManager::DoPartialCollectMode()
         return false;
     }
 
+    // If the host reported a lot of external memory since the last GC, the holders may well be old objects
+    // that a partial collect won't look at. Do a full collect so the external memory can be released.
+    if (recycler->autoHeap.lastUncollectedHostExternalBytes > RecyclerHeuristic::Instance.MaxUncollectedExternalBytesPartialCollect)
+    {
+        return false;
+    }
+
     return this->rescanRootBytes <= MaxPartialCollectRescanRootBytes;
 }
 
@@ -224,6 +224,11 @@ class WeakReferenceHashTable
         return count;
     }
 
+    uint GetBucketCount() const
+    {
+        return size;
+    }
+
     void Remove(char* key)
     {
         Remove(key, nullptr);
@@ -268,6 +273,44 @@ class WeakReferenceHashTable
 #endif
     }
 
+    // Same as Map, but only over the buckets in [startBucket, endBucket). The entry count is not updated;
+    // the caller passes the returned number of removed entries to OnEntriesRemoved. Disjoint bucket
+    // ranges share no chains, so they can be mapped on different threads at the same time.
+    template <class Func>
+    uint MapBucketRange(uint startBucket, uint endBucket, Func fn)
+    {
+        Assert(startBucket <= endBucket && endBucket <= size);
+        uint removed = 0;
+
+        for (uint i = startBucket; i < endBucket; i++)
+        {
+            RecyclerWeakReferenceBase ** pprev = &buckets[i];
+            RecyclerWeakReferenceBase *current = *pprev;
+            while (current)
+            {
+                if (fn(current))
+                {
+                    pprev = &current->next;
+                }
+                else
+                {
+                    // remove
+                    *pprev = current->next;
+                    removed++;
+                }
+                current = *pprev;
+            }
+        }
+
+        return removed;
+    }
+
+    void OnEntriesRemoved(uint removed)
+    {
+        Assert(removed <= count);
+        count -= removed;
+    }
+
 private:
     // If density is a compile-time constant, then we can optimize (avoids division)
     // Sometimes the compiler can also make this optimization, but this way is guaranteed.
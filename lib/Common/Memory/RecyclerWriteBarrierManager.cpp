@@ -558,4 +558,43 @@ RecyclerWriteBarrierManager::GetWriteBarrier(void * address)
     }
 }
 
+#ifdef RECYCLER_WRITE_BARRIER_BYTE
+size_t
+RecyclerWriteBarrierManager::FindFirstDirtyPage(void * address, size_t pageCount)
+{
+    if (CONFIG_FLAG(WriteBarrierTest))
+    {
+        // Every page reads as dirty, see GetWriteBarrier
+        return 0;
+    }
+
+    const BYTE * cards = &cardTable[GetCardTableIndex(address)];
+    size_t i = 0;
+#if defined(_M_IX86) || defined(_M_X64)
+    // Shift the dirty bit of each card into its sign bit so that movemask collects one bit per card
+    CompileAssert(DIRTYBIT == 0x01);
+    for (; i + 32 <= pageCount; i += 32)
+    {
+        const __m128i low = _mm_loadu_si128((const __m128i *)(cards + i));
+        const __m128i high = _mm_loadu_si128((const __m128i *)(cards + i + 16));
+        const uint32 dirtyMask = (uint32)_mm_movemask_epi8(_mm_slli_epi16(low, 7)) | ((uint32)_mm_movemask_epi8(_mm_slli_epi16(high, 7)) << 16);
+        if (dirtyMask != 0)
+        {
+            DWORD firstDirty;
+            _BitScanForward(&firstDirty, dirtyMask);
+            return i + firstDirty;
+        }
+    }
+#endif
+    for (; i < pageCount; i++)
+    {
+        if (cards[i] & DIRTYBIT)
+        {
+            return i;
+        }
+    }
+    return pageCount;
+}
+#endif
+
 #endif
@@ -207,6 +207,9 @@ class RecyclerWriteBarrierManager
     static void ResetWriteBarrier(void * address, size_t pageCount);
 #ifdef RECYCLER_WRITE_BARRIER_BYTE
     static BYTE  GetWriteBarrier(void * address);
+    // Returns the index of the first page with a dirty card among the pageCount pages starting at address,
+    // or pageCount if they are all clean. The cards are checked 32 at a time where SIMD is available.
+    static size_t FindFirstDirtyPage(void * address, size_t pageCount);
 #else
     static DWORD GetWriteBarrier(void * address);
 #endif
@@ -468,6 +468,13 @@ typedef unsigned short uint16_t;
         //      disabled as well
         /// </summary>
         JsRuntimeAttributeDisableExecutablePageAllocation = 0x00000100,
+        /// <summary>
+        ///     The finalize callbacks of external objects and external array buffers are thread-safe
+        ///     and don't call back into the runtime, so the runtime may invoke them on a background
+        ///     thread instead of on the script thread during garbage collection.
+        ///     Has no effect when combined with <c>JsRuntimeAttributeDisableBackgroundWork</c>.
+        /// </summary>
+        JsRuntimeAttributeEnableBackgroundFinalization = 0x00000200,
 
     } JsRuntimeAttributes;
 
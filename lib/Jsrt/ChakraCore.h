@@ -48,6 +48,11 @@ typedef void* JsModuleRecord;
 /// </remarks>
 typedef void *JsSharedArrayBufferContentHandle;
 
+/// <summary>
+///     A handle to a suspended stack registered with <c>JsRegisterSuspendedStack</c>.
+/// </summary>
+typedef void *JsSuspendedStackHandle;
+
 /// <summary>
 ///     Flags for parsing a module.
 /// </summary>
@@ -1271,5 +1276,84 @@ CHAKRA_API
         _In_ JsValueRef parserState,
         _Out_ JsValueRef * result);
 
+/// <summary>
+///     Registers the stack of a suspended fiber or coroutine so that the garbage collector
+///     scans it for references.
+/// </summary>
+/// <remarks>
+///     <para>
+///         Hosts that switch between several stacks on one runtime register each stack while it
+///         is suspended and unregister it before resuming it. The contents of a registered stack
+///         must not change. The runtime scans it once per collection, on a background thread
+///         when concurrent collection is enabled, instead of during the pause.
+///     </para>
+///     <para>
+///         The stack of the thread running script is scanned as usual and must not be registered.
+///         The call must be made on the thread the runtime is active on.
+///     </para>
+/// </remarks>
+/// <param name="runtimeHandle">The runtime whose objects the stack may reference.</param>
+/// <param name="stackTop">The lowest address of the live part of the stack.</param>
+/// <param name="stackBase">The address just past the highest address of the stack.</param>
+/// <param name="stackHandle">The handle to pass to <c>JsUnregisterSuspendedStack</c>.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsRegisterSuspendedStack(
+        _In_ JsRuntimeHandle runtimeHandle,
+        _In_ void *stackTop,
+        _In_ void *stackBase,
+        _Out_ JsSuspendedStackHandle *stackHandle);
+
+/// <summary>
+///     Unregisters a stack registered with <c>JsRegisterSuspendedStack</c>.
+/// </summary>
+/// <remarks>
+///     Must be called on the thread the runtime is active on, before the stack is resumed or
+///     freed. If a background collection is scanning this stack at that moment, the call waits
+///     for the scan of this stack to finish.
+/// </remarks>
+/// <param name="runtimeHandle">The runtime the stack was registered with.</param>
+/// <param name="stackHandle">The handle returned by <c>JsRegisterSuspendedStack</c>.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorInvalidArgument</c> if the
+///     stack isn't registered with this runtime, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsUnregisterSuspendedStack(
+        _In_ JsRuntimeHandle runtimeHandle,
+        _In_ JsSuspendedStackHandle stackHandle);
+
+/// <summary>
+///     Tells the garbage collector about native memory that is kept alive by script objects.
+/// </summary>
+/// <remarks>
+///     <para>
+///         Hosts that attach large native buffers to external objects report the size when the
+///         buffer is attached and report the negated size once it is released, typically from the
+///         object's finalize callback. Reported memory counts toward the runtime memory limit and
+///         makes the garbage collector schedule full collections sooner.
+///     </para>
+///     <para>
+///         A positive change must be reported on the thread the runtime is active on and may
+///         trigger a collection. A negative change must be reported on that thread too. If background
+///         work is enabled (the runtime was not created with <c>JsRuntimeAttributeDisableBackgroundWork</c>),
+///         a negative change may also be reported from the background finalizer thread. A runtime
+///         can't release more than has been reported to it.
+///     </para>
+/// </remarks>
+/// <param name="runtimeHandle">The runtime the memory is attributed to.</param>
+/// <param name="changeInBytes">The number of bytes allocated (positive) or released (negative).</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorOutOfMemory</c> if a positive
+///     change would exceed the runtime memory limit, <c>JsErrorInvalidArgument</c> if a negative
+///     change releases more than is still reported, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsAdjustExternalMemory(
+        _In_ JsRuntimeHandle runtimeHandle,
+        _In_ int64_t changeInBytes);
+
 #endif // _CHAKRACOREBUILD
 #endif // _CHAKRACORE_H_
@@ -288,7 +288,8 @@ JsErrorCode CreateRuntimeCore(_In_ JsRuntimeAttributes attributes,
             JsRuntimeAttributeDisableExecutablePageAllocation |
             JsRuntimeAttributeEnableExperimentalFeatures |
             JsRuntimeAttributeDispatchSetExceptionsToDebugger |
-            JsRuntimeAttributeDisableFatalOnOOM
+            JsRuntimeAttributeDisableFatalOnOOM |
+            JsRuntimeAttributeEnableBackgroundFinalization
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
             | JsRuntimeAttributeSerializeLibraryByteCode
 #endif
@@ -362,6 +363,11 @@ JsErrorCode CreateRuntimeCore(_In_ JsRuntimeAttributes attributes,
         bool dispatchExceptions = (attributes & JsRuntimeAttributeDispatchSetExceptionsToDebugger) == JsRuntimeAttributeDispatchSetExceptionsToDebugger;
 
         JsrtRuntime * runtime = HeapNew(JsrtRuntime, threadContext, enableIdle, dispatchExceptions);
+        if ((attributes & JsRuntimeAttributeEnableBackgroundFinalization) != 0 &&
+            (attributes & JsRuntimeAttributeDisableBackgroundWork) == 0)
+        {
+            runtime->EnableBackgroundFinalization();
+        }
         threadContext->SetCurrentThreadId(ThreadContext::NoThread);
         *runtimeHandle = runtime->ToHandle();
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
@@ -3221,6 +3227,134 @@ CHAKRA_API JsGetRuntimeMemoryLimit(_In_ JsRuntimeHandle runtimeHandle, _Out_ siz
     return JsNoError;
 }
 
+#ifdef _CHAKRACOREBUILD
+CHAKRA_API JsRegisterSuspendedStack(_In_ JsRuntimeHandle runtimeHandle, _In_ void *stackTop, _In_ void *stackBase, _Out_ JsSuspendedStackHandle *stackHandle)
+{
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+    PARAM_NOT_NULL(stackHandle);
+    *stackHandle = nullptr;
+    PARAM_NOT_NULL(stackTop);
+    if (stackBase <= stackTop)
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        Recycler * recycler = threadContext->EnsureRecycler();
+
+        Recycler::ExternalStack * externalStack = recycler->RegisterExternalStack(stackTop, stackBase);
+        if (externalStack == nullptr)
+        {
+            return JsErrorOutOfMemory;
+        }
+
+        *stackHandle = externalStack;
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsUnregisterSuspendedStack(_In_ JsRuntimeHandle runtimeHandle, _In_ JsSuspendedStackHandle stackHandle)
+{
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+    PARAM_NOT_NULL(stackHandle);
+
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        Recycler * recycler = threadContext->GetRecycler();
+        if (recycler == nullptr
+            || !recycler->UnregisterExternalStack(static_cast<Recycler::ExternalStack *>(stackHandle)))
+        {
+            return JsErrorInvalidArgument;
+        }
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsAdjustExternalMemory(_In_ JsRuntimeHandle runtimeHandle, _In_ int64_t changeInBytes)
+{
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+    ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+    const uint64 changeMagnitude = changeInBytes < 0 ? (uint64)0 - (uint64)changeInBytes : (uint64)changeInBytes;
+
+#if TARGET_32
+    if (changeMagnitude > SIZE_MAX)
+    {
+        return JsErrorInvalidArgument;
+    }
+#endif
+
+    if (changeInBytes < 0)
+    {
+        // Releases only update the allocation policy manager. It takes them from other threads (e.g. finalize
+        // callbacks on the background finalizer thread) only when the runtime was created with background work.
+        AllocationPolicyManager * allocPolicyManager = threadContext->GetAllocationPolicyManager();
+        if (!allocPolicyManager->SupportsConcurrency())
+        {
+            ThreadContextScope scope(threadContext);
+
+            if (!scope.IsValid())
+            {
+                return JsErrorWrongThread;
+            }
+        }
+
+        // Don't let the host release more than it has reported
+        Recycler * recycler = threadContext->GetRecycler();
+        if (recycler == nullptr || !recycler->ReleaseHostExternalMemory((size_t)changeMagnitude))
+        {
+            return JsErrorInvalidArgument;
+        }
+        return JsNoError;
+    }
+
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        if (threadContext->GetRecycler() && threadContext->GetRecycler()->IsHeapEnumInProgress())
+        {
+            return JsErrorHeapEnumInProgress;
+        }
+        else if (threadContext->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        Recycler * recycler = threadContext->EnsureRecycler();
+        const size_t allocatedBytes = (size_t)changeMagnitude;
+
+        // The host already owns the memory, so there is nothing to allocate once the request is granted
+        if (!recycler->DoExternalAllocation(allocatedBytes, []() -> bool { return true; }))
+        {
+            return JsErrorOutOfMemory;
+        }
+
+        recycler->AddHostExternalMemoryUsage(allocatedBytes);
+        return JsNoError;
+    });
+}
+#endif
+
 C_ASSERT(JsMemoryAllocate == (_JsMemoryEventType) AllocationPolicyManager::MemoryAllocateEvent::MemoryAllocate);
 C_ASSERT(JsMemoryFree == (_JsMemoryEventType) AllocationPolicyManager::MemoryAllocateEvent::MemoryFree);
 C_ASSERT(JsMemoryFailure == (_JsMemoryEventType) AllocationPolicyManager::MemoryAllocateEvent::MemoryFailure);
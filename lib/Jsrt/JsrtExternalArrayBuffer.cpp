@@ -35,6 +35,10 @@ namespace Js
 
         if (finalizeCallback != nullptr && !isDetached)
         {
+            if (!isShutdown && JsrtRuntime::TryQueueFinalizeCallback(finalizeCallback, callbackState))
+            {
+                return;
+            }
             finalizeCallback(callbackState);
         }
     }
@@ -56,6 +56,11 @@ void JsrtExternalObject::Finalize(bool isShutdown)
     JsFinalizeCallback finalizeCallback = this->GetExternalType()->GetJsFinalizeCallback();
     if (nullptr != finalizeCallback)
     {
+        if (!isShutdown && JsrtRuntime::TryQueueFinalizeCallback(finalizeCallback, this->slot))
+        {
+            return;
+        }
+
         JsrtCallbackState scope(nullptr);
         finalizeCallback(this->slot);
     }
@@ -0,0 +1,155 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "JsrtPch.h"
+#include "JsrtFinalizerThread.h"
+
+JsrtFinalizerThread::JsrtFinalizerThread() :
+    queueHead(nullptr),
+    queueTail(nullptr),
+    workReadyEvent(nullptr),
+    thread(nullptr),
+    isShuttingDown(false)
+{
+}
+
+JsrtFinalizerThread::~JsrtFinalizerThread()
+{
+    if (this->thread != nullptr)
+    {
+        {
+            AutoCriticalSection autocs(&this->queueLock);
+            this->isShuttingDown = true;
+        }
+        SetEvent(this->workReadyEvent);
+
+        DWORD result = WaitForSingleObject(this->thread, INFINITE);
+        Assert(result == WAIT_OBJECT_0);
+        CloseHandle(this->thread);
+        this->thread = nullptr;
+    }
+
+    if (this->workReadyEvent != nullptr)
+    {
+        CloseHandle(this->workReadyEvent);
+        this->workReadyEvent = nullptr;
+    }
+
+    // The host expects every finalize callback to have run once the runtime is disposed
+    InvokeCallbacks(DequeueAll());
+}
+
+bool JsrtFinalizerThread::Initialize()
+{
+    Assert(this->thread == nullptr);
+
+    this->workReadyEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
+    if (this->workReadyEvent == nullptr)
+    {
+        return false;
+    }
+
+    auto threadHandle = PlatformAgnostic::Thread::Create(0, &JsrtFinalizerThread::StaticThreadProc, this,
+        PlatformAgnostic::Thread::ThreadInitRunImmediately, _u("Chakra Finalizer Thread"));
+
+    if (threadHandle == PlatformAgnostic::Thread::InvalidHandle)
+    {
+        CloseHandle(this->workReadyEvent);
+        this->workReadyEvent = nullptr;
+        return false;
+    }
+
+    this->thread = reinterpret_cast<HANDLE>(threadHandle);
+    return true;
+}
+
+bool JsrtFinalizerThread::QueueFinalizeCallback(JsFinalizeCallback finalizeCallback, void * callbackState)
+{
+    Assert(finalizeCallback != nullptr);
+
+    if (this->thread == nullptr)
+    {
+        return false;
+    }
+
+    // We are in the middle of a sweep, don't throw on OOM; the caller runs the callback in place instead
+    PendingCallback * pendingCallback = HeapNewNoThrowStruct(PendingCallback);
+    if (pendingCallback == nullptr)
+    {
+        return false;
+    }
+
+    pendingCallback->finalizeCallback = finalizeCallback;
+    pendingCallback->callbackState = callbackState;
+    pendingCallback->next = nullptr;
+
+    bool wasEmpty;
+    {
+        AutoCriticalSection autocs(&this->queueLock);
+        wasEmpty = (this->queueHead == nullptr);
+        if (wasEmpty)
+        {
+            this->queueHead = pendingCallback;
+        }
+        else
+        {
+            this->queueTail->next = pendingCallback;
+        }
+        this->queueTail = pendingCallback;
+    }
+
+    // The finalizer thread drains the whole queue each time it wakes up
+    if (wasEmpty)
+    {
+        SetEvent(this->workReadyEvent);
+    }
+    return true;
+}
+
+JsrtFinalizerThread::PendingCallback * JsrtFinalizerThread::DequeueAll()
+{
+    AutoCriticalSection autocs(&this->queueLock);
+    PendingCallback * pendingCallbacks = this->queueHead;
+    this->queueHead = nullptr;
+    this->queueTail = nullptr;
+    return pendingCallbacks;
+}
+
+void JsrtFinalizerThread::InvokeCallbacks(PendingCallback * pendingCallbacks)
+{
+    while (pendingCallbacks != nullptr)
+    {
+        PendingCallback * next = pendingCallbacks->next;
+        pendingCallbacks->finalizeCallback(pendingCallbacks->callbackState);
+        HeapDelete(pendingCallbacks);
+        pendingCallbacks = next;
+    }
+}
+
+unsigned int CALLBACK JsrtFinalizerThread::StaticThreadProc(LPVOID lpParameter)
+{
+    JsrtFinalizerThread * finalizerThread = (JsrtFinalizerThread *)lpParameter;
+
+    while (true)
+    {
+        DWORD result = WaitForSingleObject(finalizerThread->workReadyEvent, INFINITE);
+        Assert(result == WAIT_OBJECT_0);
+
+        bool isShuttingDown;
+        {
+            AutoCriticalSection autocs(&finalizerThread->queueLock);
+            isShuttingDown = finalizerThread->isShuttingDown;
+        }
+
+        if (isShuttingDown)
+        {
+            // Whatever is left is run by the destructor on the disposing thread
+            break;
+        }
+
+        InvokeCallbacks(finalizerThread->DequeueAll());
+    }
+
+    return 0;
+}
@@ -0,0 +1,39 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+// Runs the finalize callbacks of external objects and external array buffers on a
+// dedicated thread, so the host's cleanup work doesn't add to the sweep on the script thread.
+// Only used when the host created the runtime with JsRuntimeAttributeEnableBackgroundFinalization.
+class JsrtFinalizerThread
+{
+public:
+    JsrtFinalizerThread();
+    ~JsrtFinalizerThread();
+
+    bool Initialize();
+
+    // Returns false if the callback could not be queued and the caller needs to invoke it
+    bool QueueFinalizeCallback(JsFinalizeCallback finalizeCallback, void * callbackState);
+
+private:
+    struct PendingCallback
+    {
+        JsFinalizeCallback finalizeCallback;
+        void * callbackState;
+        PendingCallback * next;
+    };
+
+    static unsigned int CALLBACK StaticThreadProc(LPVOID lpParameter);
+    PendingCallback * DequeueAll();
+    static void InvokeCallbacks(PendingCallback * pendingCallbacks);
+
+    CriticalSection queueLock;
+    PendingCallback * queueHead;
+    PendingCallback * queueTail;
+    HANDLE workReadyEvent;
+    HANDLE thread;
+    bool isShuttingDown;
+};
@@ -15,6 +15,7 @@ JsrtRuntime::JsrtRuntime(ThreadContext * threadContext, bool useIdle, bool dispa
     this->collectCallback = NULL;
     this->beforeCollectCallback = NULL;
     this->callbackContext = NULL;
+    this->finalizerThread = nullptr;
     this->allocationPolicyManager = threadContext->GetAllocationPolicyManager();
     this->useIdle = useIdle;
     this->dispatchExceptions = dispatchExceptions;
@@ -34,6 +35,12 @@ JsrtRuntime::JsrtRuntime(ThreadContext * threadContext, bool useIdle, bool dispa
 
 JsrtRuntime::~JsrtRuntime()
 {
+    if (this->finalizerThread != nullptr)
+    {
+        // Waits for the finalizer thread and runs the callbacks it didn't get to
+        HeapDelete(this->finalizerThread);
+        this->finalizerThread = nullptr;
+    }
     HeapDelete(allocationPolicyManager);
 #ifdef ENABLE_SCRIPT_DEBUGGING
     if (this->jsrtDebugManager != nullptr)
@@ -108,6 +115,43 @@ void JsrtRuntime::SetBeforeCollectCallback(JsBeforeCollectCallback beforeCollect
     }
 }
 
+void JsrtRuntime::EnableBackgroundFinalization()
+{
+    Assert(this->finalizerThread == nullptr);
+
+    JsrtFinalizerThread * newFinalizerThread = HeapNewNoThrow(JsrtFinalizerThread);
+    if (newFinalizerThread == nullptr)
+    {
+        return;
+    }
+
+    // Without a finalizer thread the callbacks simply keep running on the script thread
+    if (!newFinalizerThread->Initialize())
+    {
+        HeapDelete(newFinalizerThread);
+        return;
+    }
+
+    this->finalizerThread = newFinalizerThread;
+}
+
+bool JsrtRuntime::TryQueueFinalizeCallback(JsFinalizeCallback finalizeCallback, void * callbackState)
+{
+    ThreadContext * threadContext = ThreadContext::GetContextForCurrentThread();
+    if (threadContext == nullptr)
+    {
+        return false;
+    }
+
+    JsrtRuntime * runtime = static_cast<JsrtRuntime *>(threadContext->GetJSRTRuntime());
+    if (runtime == nullptr || runtime->finalizerThread == nullptr)
+    {
+        return false;
+    }
+
+    return runtime->finalizerThread->QueueFinalizeCallback(finalizeCallback, callbackState);
+}
+
 void JsrtRuntime::RecyclerCollectCallbackStatic(void * context, RecyclerCollectCallBackFlags flags)
 {
     if (flags & Collect_Begin)
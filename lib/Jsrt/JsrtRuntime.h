@@ -6,6 +6,7 @@
 
 #include "ChakraCore.h"
 #include "JsrtThreadService.h"
+#include "JsrtFinalizerThread.h"
 #ifdef ENABLE_SCRIPT_DEBUGGING
 #include "JsrtDebugManager.h"
 #endif
@@ -39,6 +40,10 @@ class JsrtRuntime
     void CloseContexts();
     void SetBeforeCollectCallback(JsBeforeCollectCallback beforeCollectCallback, void * callbackContext);
 
+    void EnableBackgroundFinalization();
+    // Hands a finalize callback to the finalizer thread of the current thread's runtime, if it has one
+    static bool TryQueueFinalizeCallback(JsFinalizeCallback finalizeCallback, void * callbackState);
+
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
     void SetSerializeByteCodeForLibrary(bool set) { serializeByteCodeForLibrary = set; }
     bool IsSerializeByteCodeForLibrary() const { return serializeByteCodeForLibrary; }
@@ -66,6 +71,7 @@ class JsrtRuntime
     ThreadContext::CollectCallBack * collectCallback;
     JsBeforeCollectCallback beforeCollectCallback;
     JsrtThreadService threadService;
+    JsrtFinalizerThread * finalizerThread;
     void * callbackContext;
     bool useIdle;
     bool dispatchExceptions;
@@ -6073,6 +6073,11 @@ ScriptContext::GetJitFuncRangeCache()
             Output::Print(_u("\n\n"));
         }
 #undef MAX_BUCKETS
+
+        if (PHASE_STATS1(Js::BackEndPhase))
+        {
+            PrintJitPhaseStats();
+        }
 #endif
 
 #ifdef REJIT_STATS
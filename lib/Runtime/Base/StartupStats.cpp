@@ -0,0 +1,63 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeBasePch.h"
+
+namespace Js
+{
+    bool StartupStats::enabled = false;
+    long long StartupStats::ticks[StartupStats::PhaseCount];
+    unsigned int StartupStats::counts[StartupStats::PhaseCount];
+
+    static const char * const startupPhaseNames[StartupStats::PhaseCount] =
+    {
+        "LibraryInit",
+        "JsBuiltInDeserialize",
+        "JsBuiltInInit",
+        "IntlDeserialize",
+        "IntlInit"
+    };
+
+    void StartupStats::Reset()
+    {
+        memset(ticks, 0, sizeof(ticks));
+        memset(counts, 0, sizeof(counts));
+    }
+
+    // The PlatformAgnostic HiResTimer only has millisecond resolution (and caches its value) on
+    // xplat, which is too coarse for these phases, so read the performance counter directly.
+    long long StartupStats::Now()
+    {
+        LARGE_INTEGER counter;
+        QueryPerformanceCounter(&counter);
+        return counter.QuadPart;
+    }
+
+    void StartupStats::Record(Phase phase, long long startTicks)
+    {
+        Assert(phase < PhaseCount);
+        ticks[phase] += Now() - startTicks;
+        counts[phase]++;
+    }
+
+    double StartupStats::GetTimeMs(Phase phase)
+    {
+        Assert(phase < PhaseCount);
+        LARGE_INTEGER frequency;
+        QueryPerformanceFrequency(&frequency);
+        return (double)ticks[phase] * 1000 / (double)frequency.QuadPart;
+    }
+
+    unsigned int StartupStats::GetCount(Phase phase)
+    {
+        Assert(phase < PhaseCount);
+        return counts[phase];
+    }
+
+    const char * StartupStats::GetPhaseName(Phase phase)
+    {
+        Assert(phase < PhaseCount);
+        return startupPhaseNames[phase];
+    }
+}
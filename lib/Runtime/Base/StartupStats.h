@@ -0,0 +1,78 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Js
+{
+    ///---------------------------------------------------------------------------
+    ///
+    /// class StartupStats
+    ///
+    ///     Wall clock breakdown of the work done the first time a context is created
+    ///     and used: library initialization and the deserialization and injection of
+    ///     the JsBuiltIn and Intl bytecode. Unlike -Profile:LibInit this is available in
+    ///     release builds so that bin/StartupBench can measure the shipping engine.
+    ///
+    ///     Collection is off by default and costs a branch per phase when disabled. Times
+    ///     are inclusive (an Init phase includes its Deserialize phase) and accumulate
+    ///     until Reset. The counters are not synchronized; enable them only in a host
+    ///     that creates contexts on one thread at a time.
+    ///
+    ///     This header only depends on built-in types so that hosts can include it.
+    ///
+    ///---------------------------------------------------------------------------
+
+    class StartupStats
+    {
+    public:
+        enum Phase
+        {
+            LibraryInit,
+            JsBuiltInDeserialize,
+            JsBuiltInInit,
+            IntlDeserialize,
+            IntlInit,
+            PhaseCount
+        };
+
+        static void SetEnabled(bool enable) { enabled = enable; }
+        static bool IsEnabled() { return enabled; }
+        static void Reset();
+
+        static double GetTimeMs(Phase phase);
+        static unsigned int GetCount(Phase phase);
+        static const char * GetPhaseName(Phase phase);
+
+        static long long Now();
+        static void Record(Phase phase, long long startTicks);
+
+    private:
+        static bool enabled;
+        static long long ticks[PhaseCount];
+        static unsigned int counts[PhaseCount];
+    };
+
+    class AutoStartupPhase
+    {
+    public:
+        AutoStartupPhase(StartupStats::Phase phase) :
+            phase(phase),
+            startTicks(StartupStats::IsEnabled() ? StartupStats::Now() : 0)
+        {
+        }
+
+        ~AutoStartupPhase()
+        {
+            if (startTicks != 0)
+            {
+                StartupStats::Record(phase, startTicks);
+            }
+        }
+
+    private:
+        StartupStats::Phase phase;
+        long long startTicks;
+    };
+}
@@ -142,6 +142,9 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     sourceCodeSize(0),
     nativeCodeSize(0),
     threadAlloc(_u("TC"), GetPageAllocator(), Js::Throw::OutOfMemory),
+#ifdef ENABLE_WASM
+    wasmSignatureRegistry(nullptr),
+#endif
     inlineCacheThreadInfoAllocator(_u("TC-InlineCacheInfo"), GetPageAllocator(), Js::Throw::OutOfMemory),
     isInstInlineCacheThreadInfoAllocator(_u("TC-IsInstInlineCacheInfo"), GetPageAllocator(), Js::Throw::OutOfMemory),
     equivalentTypeCacheInfoAllocator(_u("TC-EquivalentTypeCacheInfo"), GetPageAllocator(), Js::Throw::OutOfMemory),
@@ -336,6 +339,18 @@ ThreadContext::GetSimdTempAreaAddr(uint8 tempIndex) const
 }
 #endif
 
+#ifdef ENABLE_WASM
+Wasm::WasmSignatureRegistry *
+ThreadContext::GetWasmSignatureRegistry()
+{
+    if (this->wasmSignatureRegistry == nullptr)
+    {
+        this->wasmSignatureRegistry = Anew(GetThreadAlloc(), Wasm::WasmSignatureRegistry, GetThreadAlloc());
+    }
+    return this->wasmSignatureRegistry;
+}
+#endif
+
 intptr_t
 ThreadContext::GetDisableImplicitFlagsAddr() const
 {
@@ -26,6 +26,12 @@ struct IAuthorFileContext;
 class HostScriptContext;
 class ScriptSite;
 class ThreadServiceWrapper;
+#ifdef ENABLE_WASM
+namespace Wasm
+{
+    class WasmSignatureRegistry;
+}
+#endif
 struct IActiveScriptProfilerHeapEnum;
 class DynamicProfileMutator;
 class StackProber;
@@ -669,6 +675,9 @@ class ThreadContext sealed :
     Js::InterpreterStackFrame* leafInterpreterFrame;
     const Js::PropertyRecord * propertyNamesDirect[128];
     ArenaAllocator threadAlloc;
+#ifdef ENABLE_WASM
+    Wasm::WasmSignatureRegistry * wasmSignatureRegistry;
+#endif
     ThreadServiceWrapper* threadServiceWrapper;
     uint functionCount;
     uint sourceInfoCount;
@@ -1114,6 +1123,9 @@ class ThreadContext sealed :
 
     DateTime::HiResTimer * GetHiResTimer() { return &hTimer; }
     ArenaAllocator* GetThreadAlloc() { return &threadAlloc; }
+#ifdef ENABLE_WASM
+    Wasm::WasmSignatureRegistry * GetWasmSignatureRegistry();
+#endif
     static CriticalSection * GetCriticalSection() { return &s_csThreadContext; }
 
     ThreadContext(AllocationPolicyManager * allocationPolicyManager = nullptr, JsUtil::ThreadService::ThreadServiceCallback threadServiceCallback = nullptr, bool enableExperimentalFeatures = false);
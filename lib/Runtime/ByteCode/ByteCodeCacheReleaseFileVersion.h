@@ -4,6 +4,6 @@
 //-------------------------------------------------------------------------------------------------------
 // NOTE: If there is a merge conflict the correct fix is to make a new GUID.
 
-// {D8913E7E-E430-4B28-81DD-EDD3EE5F263B}
+// {C0F01E4E-3271-4B33-ACDF-8E9259C7BE6E}
 const GUID byteCodeCacheReleaseFileVersion =
-{ 0xD8913E7E, 0xE430, 0x4B28, { 0x81, 0xDD, 0xED, 0xD3, 0xEE, 0x5F, 0x26, 0x3B } };
+{ 0xC0F01E4E, 0x3271, 0x4B33, { 0xAC, 0xDF, 0x8E, 0x92, 0x59, 0xC7, 0xBE, 0x6E } };
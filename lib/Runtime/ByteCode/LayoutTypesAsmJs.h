@@ -164,6 +164,7 @@ LAYOUT_TYPE_WMS_REG3  ( Int1Double2   , Int, Double, Double) // 1 int register a
 LAYOUT_TYPE_WMS_REG3  ( Int1Float2    , Int, Float, Float) // 1 int register and 2 float register ( float comparisons )
 LAYOUT_TYPE_WMS_REG2  ( Int2          , Int, Int) // 2 int register
 LAYOUT_TYPE_WMS_REG3  ( Int3          , Int, Int, Int) // 3 int register
+LAYOUT_TYPE_WMS_REG4  ( Int4          , Int, Int, Int, Int) // 4 int register
 LAYOUT_TYPE_WMS_REG2  ( Double2       , Double, Double) // 2 double register
 LAYOUT_TYPE_WMS_REG2  ( Float2        , Float, Float) // 2 float register
 LAYOUT_TYPE_WMS_REG3  ( Float3        , Float, Float, Float) // 3 float register
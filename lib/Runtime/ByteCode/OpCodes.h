@@ -486,6 +486,10 @@ MACRO_BACKEND_ONLY(     LdWasmFunc,                 ElementSlot,    OpSideEffect
 
 MACRO_BACKEND_ONLY(     CheckWasmSignature,         Reg2,           OpSideEffect)
 MACRO_BACKEND_ONLY(     GrowWasmMemory,             Reg3,           OpSideEffect)
+MACRO_BACKEND_ONLY(     WasmMemoryCopy,             Empty,          OpSideEffect)
+MACRO_BACKEND_ONLY(     WasmMemoryFill,             Empty,          OpSideEffect)
+MACRO_BACKEND_ONLY(     WasmMemoryInit,             Empty,          OpSideEffect)
+MACRO_BACKEND_ONLY(     WasmDataDrop,               Empty,          OpSideEffect)
 
 #ifndef FLOAT_VAR
 MACRO_BACKEND_ONLY(     StSlotBoxTemp,              Empty,          OpSideEffect|OpTempNumberSources)
@@ -304,6 +304,10 @@ MACRO_EXTEND_WMS( Nearest_Db                 , Double2         , None
 MACRO_EXTEND_WMS( Nearest_Flt                , Float2          , None            )
 MACRO_EXTEND_WMS( MemorySize_Int             , AsmReg1         , None            )
 MACRO_EXTEND_WMS( GrowMemory                 , Int2            , None            )
+MACRO_EXTEND_WMS( MemoryCopy                 , Int3            , None            ) // dst, src, count
+MACRO_EXTEND_WMS( MemoryFill                 , Int3            , None            ) // dst, value, count
+MACRO_EXTEND_WMS( MemoryInit                 , Int4            , None            ) // segment, dst, src, count
+MACRO_EXTEND_WMS( DataDrop                   , AsmReg1         , None            ) // segment
 MACRO_EXTEND    ( Unreachable_Void           , Empty           , OpNoFallThrough )
 MACRO_EXTEND_WMS( Conv_Check_DTI             , Int1Double1     , None            )
 MACRO_EXTEND_WMS( Conv_Check_FTI             , Int1Float1      , None            )
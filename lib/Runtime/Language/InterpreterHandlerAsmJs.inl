@@ -258,6 +258,10 @@ EXDEF2_WMS( D1toD1Mem        , Trunc_Db         , Wasm::WasmMath::Trunc<double>
 EXDEF2_WMS( D1toD1Mem        , Nearest_Db       , Wasm::WasmMath::Nearest<double>                    )
 EXDEF2_WMS( VtoI1Mem         , MemorySize_Int   , OP_GetMemorySize                                   )
 EXDEF2_WMS( I1toI1Mem        , GrowMemory       , OP_GrowMemory                                      )
+EXDEF3_WMS( CUSTOM_ASMJS     , MemoryCopy       , OP_WasmMemoryCopy                         , Int3    )
+EXDEF3_WMS( CUSTOM_ASMJS     , MemoryFill       , OP_WasmMemoryFill                         , Int3    )
+EXDEF3_WMS( CUSTOM_ASMJS     , MemoryInit       , OP_WasmMemoryInit                         , Int4    )
+EXDEF3_WMS( CUSTOM_ASMJS     , DataDrop         , OP_WasmDataDrop                           , AsmReg1 )
 EXDEF2    ( EMPTYASMJS       , Unreachable_Void , OP_Unreachable                                     )
 EXDEF2_WMS( D1toI1Ctx        , Conv_Check_DTI   , Wasm::WasmMath::F64ToI32<false /* saturating */>  )
 EXDEF2_WMS( F1toI1Ctx        , Conv_Check_FTI   , Wasm::WasmMath::F32ToI32<false /* saturating */>  )
@@ -7997,6 +7997,48 @@ namespace Js
 #endif
     }
 
+    template <class T>
+    void InterpreterStackFrame::OP_WasmMemoryCopy(const unaligned T* playout)
+    {
+#ifdef ENABLE_WASM
+        GetWebAssemblyMemory()->Copy((uint32)GetRegRawInt(playout->I0), (uint32)GetRegRawInt(playout->I1), (uint32)GetRegRawInt(playout->I2));
+#else
+        Assert(UNREACHED);
+#endif
+    }
+
+    template <class T>
+    void InterpreterStackFrame::OP_WasmMemoryFill(const unaligned T* playout)
+    {
+#ifdef ENABLE_WASM
+        GetWebAssemblyMemory()->Fill((uint32)GetRegRawInt(playout->I0), GetRegRawInt(playout->I1), (uint32)GetRegRawInt(playout->I2));
+#else
+        Assert(UNREACHED);
+#endif
+    }
+
+    template <class T>
+    void InterpreterStackFrame::OP_WasmMemoryInit(const unaligned T* playout)
+    {
+#ifdef ENABLE_WASM
+        Field(Var)* moduleEnv = (Field(Var)*)m_localSlots[AsmJsFunctionMemory::ModuleEnvRegister];
+        WebAssemblyMemory::InitHelper(moduleEnv, (uint32)GetRegRawInt(playout->I0), (uint32)GetRegRawInt(playout->I1), (uint32)GetRegRawInt(playout->I2), (uint32)GetRegRawInt(playout->I3));
+#else
+        Assert(UNREACHED);
+#endif
+    }
+
+    template <class T>
+    void InterpreterStackFrame::OP_WasmDataDrop(const unaligned T* playout)
+    {
+#ifdef ENABLE_WASM
+        Field(Var)* moduleEnv = (Field(Var)*)m_localSlots[AsmJsFunctionMemory::ModuleEnvRegister];
+        WebAssemblyMemory::DataDropHelper(moduleEnv, (uint32)GetRegRawInt(playout->R0));
+#else
+        Assert(UNREACHED);
+#endif
+    }
+
     template <typename T, InterpreterStackFrame::AsmJsMathPtr<T> func> T InterpreterStackFrame::OP_UnsignedDivRemCheck(T aLeft, T aRight, ScriptContext* scriptContext)
     {
         if (aRight == 0)
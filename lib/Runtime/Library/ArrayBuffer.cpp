@@ -905,19 +905,7 @@ namespace Js
                 // Recycler may not be available at Dispose. We need to
                 // free the memory and report that it has been freed at the same
                 // time. Otherwise, AllocationPolicyManager is unable to provide correct feedback
-#if ENABLE_FAST_ARRAYBUFFER
-        //AsmJS Virtual Free
-                if (buffer && IsValidVirtualBufferLength(this->bufferLength))
-                {
-                    FreeMemAlloc(buffer);
-                }
-                else
-                {
-                    free(buffer);
-                }
-#else
-                free(buffer);
-#endif
+                FreeBuffer(buffer);
             }
             Recycler* recycler = GetType()->GetLibrary()->GetRecycler();
             recycler->ReportExternalMemoryFree(bufferLength);
@@ -932,6 +920,19 @@ namespace Js
         /* See JavascriptArrayBuffer::Finalize */
     }
 
+    void JavascriptArrayBuffer::FreeBuffer(BYTE* buffer)
+    {
+#if ENABLE_FAST_ARRAYBUFFER
+        //AsmJS Virtual Free
+        if (IsValidVirtualBufferLength(this->bufferLength))
+        {
+            FreeMemAlloc(buffer);
+            return;
+        }
+#endif
+        free(buffer);
+    }
+
 #if ENABLE_TTD
     TTD::NSSnapObjects::SnapObjectType JavascriptArrayBuffer::GetSnapTag_TTD() const
     {
@@ -1049,6 +1050,41 @@ namespace Js
         return result;
     }
 
+    WebAssemblyArrayBuffer* WebAssemblyArrayBuffer::Create(uint32 length, uint32 maxLength, DynamicType * type)
+    {
+        AssertOrFailFast(length <= maxLength);
+        // The 8Gb array already reserves all the address space it can grow into
+        if (CONFIG_FLAG(WasmReserveMemory) && !CONFIG_FLAG(WasmFastArray))
+        {
+            byte* buffer = (byte*)AllocWrapper(length, maxLength);
+            if (buffer)
+            {
+                return CreateReserved(buffer, length, maxLength, type);
+            }
+            // Fall back to the heap if we're out of address space
+        }
+        return Create(nullptr, length, type);
+    }
+
+    WebAssemblyArrayBuffer* WebAssemblyArrayBuffer::CreateReserved(byte* buffer, uint32 length, uint32 reservedLength, DynamicType * type)
+    {
+        Assert(buffer && length <= reservedLength);
+        WebAssemblyArrayBuffer* result = Create(buffer, length, type);
+        result->reservedLength = reservedLength;
+        return result;
+    }
+
+    void WebAssemblyArrayBuffer::FreeBuffer(BYTE* buffer)
+    {
+        if (IsReserved())
+        {
+            // Release the whole reserved range
+            FreeMemAlloc(buffer);
+            return;
+        }
+        JavascriptArrayBuffer::FreeBuffer(buffer);
+    }
+
     bool WebAssemblyArrayBuffer::IsValidVirtualBufferLength(uint length) const
     {
 #if ENABLE_FAST_ARRAYBUFFER
@@ -1088,9 +1124,74 @@ namespace Js
         // We're not growing the buffer, just create a new WebAssemblyArrayBuffer and detach this
         if (growSize == 0)
         {
+            if (IsReserved())
+            {
+                return finalizeGrowMemory(CreateReserved(this->GetBuffer(), this->bufferLength, this->reservedLength, this->GetLibrary()->GetArrayBufferType()));
+            }
             return finalizeGrowMemory(this->GetLibrary()->CreateWebAssemblyArrayBuffer(this->GetBuffer(), this->bufferLength));
         }
 
+        // The memory has no declared maximum and outgrew its reservation, move it to one at least twice as large.
+        // Growing stays amortized O(delta) and the old range is released once the contents are copied.
+        if (IsReserved() && newBufferLength > this->reservedLength)
+        {
+            AssertOrFailFast(this->GetBuffer());
+            const uint32 newReservedLength = max(newBufferLength,
+                this->reservedLength < MaxArrayBufferLength / 2 ? this->reservedLength * 2 : MaxArrayBufferLength);
+
+            // Disable Interrupts while moving the buffer, the old range is gone once the new one is filled
+            AutoDisableInterrupt autoDisableInterrupt(this->GetScriptContext()->GetThreadContext(), false);
+
+            byte* newBuffer = nullptr;
+            const auto moveFunc = [&]
+            {
+                newBuffer = (byte*)AllocWrapper(newBufferLength, newReservedLength);
+                if (newBuffer == nullptr)
+                {
+                    return false;
+                }
+                js_memcpy_s(newBuffer, newBufferLength, this->GetBuffer(), this->bufferLength);
+                FreeMemAlloc(this->GetBuffer());
+                // if anything goes wrong before we detach, we can't recover the state and should failfast
+                autoDisableInterrupt.RequireExplicitCompletion();
+                return true;
+            };
+
+            if (!this->GetRecycler()->DoExternalAllocation(growSize, moveFunc))
+            {
+                return nullptr;
+            }
+
+            // We are transferring the buffer to the new owner.
+            // To avoid double-charge to the allocation quota we will free the "diff" amount here.
+            this->GetRecycler()->ReportExternalMemoryFree(growSize);
+
+            WebAssemblyArrayBuffer* newArrayBuffer = finalizeGrowMemory(CreateReserved(newBuffer, newBufferLength, newReservedLength, this->GetLibrary()->GetArrayBufferType()));
+            // We've successfully Detached this buffer and created a new WebAssemblyArrayBuffer
+            autoDisableInterrupt.Completed();
+            return newArrayBuffer;
+        }
+
+        // The address space is reserved up to the new length, commit the new pages in place
+        if (IsReserved())
+        {
+            AssertOrFailFast(this->GetBuffer() && newBufferLength <= this->reservedLength);
+            const auto virtualAllocFunc = [&]
+            {
+                return !!VirtualAlloc(this->GetBuffer() + this->bufferLength, growSize, MEM_COMMIT, PAGE_READWRITE);
+            };
+            if (!this->GetRecycler()->DoExternalAllocation(growSize, virtualAllocFunc))
+            {
+                return nullptr;
+            }
+
+            // We are transferring the buffer to the new owner.
+            // To avoid double-charge to the allocation quota we will free the "diff" amount here.
+            this->GetRecycler()->ReportExternalMemoryFree(growSize);
+
+            return finalizeGrowMemory(CreateReserved(this->GetBuffer(), newBufferLength, this->reservedLength, this->GetLibrary()->GetArrayBufferType()));
+        }
+
 #if ENABLE_FAST_ARRAYBUFFER
         // 8Gb Array case
         if (CONFIG_FLAG(WasmFastArray))
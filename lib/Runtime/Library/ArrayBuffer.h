@@ -31,7 +31,6 @@ namespace Js
             Js::Throw::FatalInternalError();
         }
 #endif
-#ifdef _WIN32
         static void* __cdecl AllocWrapper(DECLSPEC_GUARD_OVERFLOW size_t length, size_t MaxVirtualSize)
         {
             LPVOID address = VirtualAlloc(nullptr, MaxVirtualSize, MEM_RESERVE, PAGE_NOACCESS);
@@ -65,13 +64,6 @@ namespace Js
             BOOL fSuccess = VirtualFree((LPVOID)ptr, 0, MEM_RELEASE);
             Assert(fSuccess);
         }
-#else
-        static void FreeMemAlloc(Var ptr)
-        {
-            // This free function should never be used
-            Js::Throw::FatalInternalError();
-        }
-#endif
     public:
         DEFINE_VTABLE_CTOR_ABSTRACT(ArrayBufferBase, DynamicObject);
 
@@ -307,6 +299,7 @@ namespace Js
     protected:
         JavascriptArrayBuffer(DynamicType * type);
         virtual ArrayBufferDetachedStateBase* CreateDetachedState(RefCountedBuffer * content, DECLSPEC_GUARD_OVERFLOW uint32 bufferLength) override;
+        virtual void FreeBuffer(BYTE* buffer);
 
         template<typename Allocator>
         JavascriptArrayBuffer(uint32 length, DynamicType * type, Allocator allocator): ArrayBuffer(length, type, allocator){}
@@ -333,13 +326,23 @@ namespace Js
         DEFINE_MARSHAL_OBJECT_TO_SCRIPT_CONTEXT(WebAssemblyArrayBuffer);
     public:
         static WebAssemblyArrayBuffer* Create(byte* buffer, DECLSPEC_GUARD_OVERFLOW uint32 length, DynamicType * type);
+        // Reserves the address space up to maxLength, when possible, so the buffer can grow without being copied
+        static WebAssemblyArrayBuffer* Create(DECLSPEC_GUARD_OVERFLOW uint32 length, DECLSPEC_GUARD_OVERFLOW uint32 maxLength, DynamicType * type);
         WebAssemblyArrayBuffer* GrowMemory(uint32 newBufferLength);
 
         virtual bool IsValidVirtualBufferLength(uint length) const override;
         virtual bool IsWebAssemblyArrayBuffer() override { return true; }
+        bool IsReserved() const { return reservedLength != 0; }
 
     protected:
         virtual ArrayBufferDetachedStateBase* CreateDetachedState(RefCountedBuffer * content, DECLSPEC_GUARD_OVERFLOW uint32 bufferLength) override;
+        virtual void FreeBuffer(BYTE* buffer) override;
+
+    private:
+        static WebAssemblyArrayBuffer* CreateReserved(byte* buffer, uint32 length, uint32 reservedLength, DynamicType * type);
+
+        // Size of the address space reserved for the buffer, 0 if it was allocated on the heap
+        Field(uint32) reservedLength = 0;
     };
 #endif
 
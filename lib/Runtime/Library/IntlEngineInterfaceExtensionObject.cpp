@@ -709,6 +709,7 @@ PROJECTED_ENUMS(PROJECTED_ENUM)
     {
         if (this->intlByteCode == nullptr)
         {
+            AutoStartupPhase autoStartupPhase(StartupStats::IntlDeserialize);
             SourceContextInfo * sourceContextInfo = scriptContext->GetSourceContextInfo(Js::Constants::NoHostSourceContext, NULL);
 
             Assert(sourceContextInfo != nullptr);
@@ -734,6 +735,7 @@ PROJECTED_ENUMS(PROJECTED_ENUM)
         WindowsGlobalizationAdapter* globAdapter = GetWindowsGlobalizationAdapter(scriptContext);
 #endif
 
+        AutoStartupPhase autoStartupPhase(StartupStats::IntlInit);
         try {
             this->EnsureIntlByteCode(scriptContext);
             Assert(intlByteCode != nullptr);
@@ -92,6 +92,7 @@ namespace Js
     void JavascriptLibrary::Initialize(ScriptContext* scriptContext, GlobalObject * globalObject)
     {
         PROBE_STACK(scriptContext, Js::Constants::MinStackDefault);
+        AutoStartupPhase autoStartupPhase(StartupStats::LibraryInit);
 #ifdef PROFILE_EXEC
         scriptContext->ProfileBegin(Js::LibInitPhase);
 #endif
@@ -5563,6 +5564,11 @@ namespace Js
         return WebAssemblyArrayBuffer::Create(nullptr, length, arrayBufferType);
     }
 
+    Js::WebAssemblyArrayBuffer* JavascriptLibrary::CreateWebAssemblyArrayBuffer(uint32 length, uint32 maxLength)
+    {
+        return WebAssemblyArrayBuffer::Create(length, maxLength, arrayBufferType);
+    }
+
     Js::WebAssemblyArrayBuffer* JavascriptLibrary::CreateWebAssemblyArrayBuffer(byte* buffer, uint32 length)
     {
         return WebAssemblyArrayBuffer::Create(buffer, length, arrayBufferType);
@@ -130,6 +130,7 @@ namespace Js
             return;
         }
 
+        AutoStartupPhase autoStartupPhase(StartupStats::JsBuiltInInit);
         try {
             EnsureJsBuiltInByteCode(scriptContext);
             Assert(jsBuiltInByteCode != nullptr);
@@ -245,6 +246,7 @@ namespace Js
     {
         if (jsBuiltInByteCode == nullptr)
         {
+            AutoStartupPhase autoStartupPhase(StartupStats::JsBuiltInDeserialize);
             SourceContextInfo* sourceContextInfo = RecyclerNewStructZ(scriptContext->GetRecycler(), SourceContextInfo);
             sourceContextInfo->dwHostSourceContext = Js::Constants::JsBuiltInSourceContext;
             sourceContextInfo->isHostDynamicDocument = true;
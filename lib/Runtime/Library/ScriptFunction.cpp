@@ -563,11 +563,18 @@ using namespace Js;
 
 #ifdef ENABLE_WASM
     WasmScriptFunction::WasmScriptFunction(FunctionProxy * proxy, ScriptFunctionType* deferredPrototypeType) :
-        AsmJsScriptFunction(proxy, deferredPrototypeType), m_signature(nullptr)
+        AsmJsScriptFunction(proxy, deferredPrototypeType), m_signature(nullptr), m_signatureKey(Js::Constants::InvalidSignature)
     {
         Assert(!proxy->GetFunctionInfo()->HasComputedName());
     }
 
+    void WasmScriptFunction::SetSignature(Wasm::WasmSignature * sig)
+    {
+        Assert(sig->GetShortSig() != Js::Constants::InvalidSignature);
+        m_signature = sig;
+        m_signatureKey = sig->GetShortSig();
+    }
+
     WebAssemblyMemory* WasmScriptFunction::GetWebAssemblyMemory() const
     {
         return (WebAssemblyMemory*)PointerValue(
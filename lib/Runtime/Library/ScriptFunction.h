@@ -195,9 +195,10 @@ namespace Js
     public:
         WasmScriptFunction(FunctionProxy * proxy, ScriptFunctionType* deferredPrototypeType);
 
-        void SetSignature(Wasm::WasmSignature * sig) { m_signature = sig; }
+        void SetSignature(Wasm::WasmSignature * sig);
         Wasm::WasmSignature * GetSignature() const { return m_signature; }
         static uint32 GetOffsetOfSignature() { return offsetof(WasmScriptFunction, m_signature); }
+        static uint32 GetOffsetOfSignatureKey() { return offsetof(WasmScriptFunction, m_signatureKey); }
 
         WebAssemblyMemory* GetWebAssemblyMemory() const;
 
@@ -207,6 +208,8 @@ namespace Js
         DEFINE_MARSHAL_OBJECT_TO_SCRIPT_CONTEXT(WasmScriptFunction);
     private:
         Field(Wasm::WasmSignature *) m_signature;
+        // Copy of the signature's short sig so call_indirect can check it without loading the signature
+        Field(size_t) m_signatureKey;
     };
 
     template <> inline bool VarIsImpl<WasmScriptFunction>(RecyclableObject* obj)
@@ -296,17 +296,6 @@ WebAssembly::ToNonWrappingUint32(Var val, ScriptContext * ctx)
     return (uint32)i;
 }
 
-void
-WebAssembly::CheckSignature(ScriptContext * scriptContext, Wasm::WasmSignature * sig1, Wasm::WasmSignature * sig2)
-{
-    JIT_HELPER_NOT_REENTRANT_NOLOCK_HEADER(Op_CheckWasmSignature);
-    if (!sig1->IsEquivalent(sig2))
-    {
-        JavascriptError::ThrowWebAssemblyRuntimeError(scriptContext, WASMERR_SignatureMismatch);
-    }
-    JIT_HELPER_END(Op_CheckWasmSignature);
-}
-
 uint
 WebAssembly::GetSignatureSize()
 {
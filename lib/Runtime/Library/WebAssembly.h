@@ -35,7 +35,6 @@ class WebAssembly
     static Var EntryQueryResponse(RecyclableObject* function, CallInfo callInfo, ...);
 
     static uint32 ToNonWrappingUint32(Var val, ScriptContext * ctx);
-    static void CheckSignature(ScriptContext * scriptContext, Wasm::WasmSignature * sig1, Wasm::WasmSignature * sig2);
     static uint GetSignatureSize();
 
 private:
@@ -218,6 +218,10 @@ void WebAssemblyEnvironment::CalculateOffsets(WebAssemblyTable* table, WebAssemb
     {
         Wasm::WasmDataSegment* segment = module->GetDataSeg(iSeg);
         Assert(segment != nullptr);
+        if (segment->IsPassive())
+        {
+            continue;
+        }
         const uint32 offset = module->GetOffsetFromInit(segment->GetOffsetExpr(), this);
         const uint32 size = segment->GetSourceSize();
 
@@ -251,5 +255,18 @@ uint32 WebAssemblyEnvironment::GetDataSegmentOffset(uint32 index) const
     return dataSegmentOffsets[index];
 }
 
+void WebAssemblyEnvironment::SetDataSegments(Wasm::WasmDataSegment** segments)
+{
+    Field(Var)* dst = start + module->GetDataSegmentsOffset();
+    CheckPtrIsValid<Var>((intptr_t)dst);
+    AssertMsg(*dst == nullptr, "We shouldn't overwrite anything on the environment once it is set");
+    *dst = segments;
+}
+
+Wasm::WasmDataSegment** WebAssemblyEnvironment::GetDataSegments(Field(Var)* moduleEnv)
+{
+    return (Wasm::WasmDataSegment**)PointerValue(moduleEnv[WebAssemblyModule::GetDataSegmentsOffset()]);
+}
+
 } // namespace Js
 #endif // ENABLE_WASM
@@ -8,6 +8,7 @@
 namespace Wasm
 {
     class WasmGlobal;
+    class WasmDataSegment;
     struct WasmConstLitNode;
 }
 namespace Js
@@ -36,6 +37,10 @@ namespace Js
         uint32 GetElementSegmentOffset(uint32 index) const;
         uint32 GetDataSegmentOffset(uint32 index) const;
 
+        // Segments memory.init can still read from, indexed by data segment index. Dropped segments are null.
+        void SetDataSegments(Wasm::WasmDataSegment** segments);
+        static Wasm::WasmDataSegment** GetDataSegments(Field(Var)* moduleEnv);
+
     private:
         Field(WebAssemblyModule*) module;
         Field(Field(Var)*) start;
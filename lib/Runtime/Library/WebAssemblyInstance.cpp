@@ -188,22 +188,39 @@ void WebAssemblyInstance::CreateWasmFunctions(WebAssemblyModule * wasmModule, Sc
 
 void WebAssemblyInstance::InitializeDataSegs(WebAssemblyModule * wasmModule, ScriptContext* ctx, WebAssemblyEnvironment* env)
 {
-    WebAssemblyMemory* mem = env->GetMemory(0);
-    Assert(mem);
-    ArrayBufferBase* buffer = mem->GetBuffer();
-
+    Wasm::WasmDataSegment** passiveSegments = nullptr;
     for (uint32 iSeg = 0; iSeg < wasmModule->GetDataSegCount(); ++iSeg)
     {
         Wasm::WasmDataSegment* segment = wasmModule->GetDataSeg(iSeg);
         Assert(segment != nullptr);
+        if (segment->IsPassive())
+        {
+            // Active segments are dropped once copied, only passive ones stay available to memory.init
+            if (!passiveSegments)
+            {
+                passiveSegments = RecyclerNewArrayLeafZ(ctx->GetRecycler(), Wasm::WasmDataSegment*, wasmModule->GetDataSegCount());
+            }
+            passiveSegments[iSeg] = segment;
+            continue;
+        }
+
         const uint32 offset = env->GetDataSegmentOffset(iSeg);
         const uint32 size = segment->GetSourceSize();
 
         if (size > 0)
         {
+            // Modules with only passive segments don't need a memory
+            WebAssemblyMemory* mem = env->GetMemory(0);
+            Assert(mem);
+            ArrayBufferBase* buffer = mem->GetBuffer();
             js_memcpy_s(buffer->GetBuffer() + offset, (uint32)buffer->GetByteLength() - offset, segment->GetData(), size);
         }
     }
+
+    if (passiveSegments)
+    {
+        env->SetDataSegments(passiveSegments);
+    }
 }
 
 Var WebAssemblyInstance::CreateExportObject(WebAssemblyModule * wasmModule, ScriptContext* scriptContext, WebAssemblyEnvironment* env)
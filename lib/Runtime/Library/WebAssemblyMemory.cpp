@@ -7,6 +7,7 @@
 
 #ifdef ENABLE_WASM
 #include "WasmLimits.h"
+#include "../WasmReader/WasmReaderPch.h"
 
 using namespace Js;
 
@@ -87,7 +88,7 @@ WebAssemblyMemory::NewInstance(RecyclableObject* function, CallInfo callInfo, ..
         isShared = JavascriptConversion::ToBool(sharedVar, scriptContext);
     }
 
-    return CreateMemoryObject(initial, maximum, isShared, scriptContext);
+    return CreateMemoryObject(initial, maximum, hasMaximum, isShared, scriptContext);
 }
 
 Var
@@ -201,6 +202,94 @@ WebAssemblyMemory::GrowHelper(WebAssemblyMemory * mem, uint32 deltaPages)
     JIT_HELPER_END(Op_GrowWasmMemory);
 }
 
+// Bulk memory operators check the whole range up front so a trapping operation doesn't write anything.
+// The length is read once; a shared memory can only grow concurrently so the range stays valid.
+// Accesses to a shared memory are not atomic, as allowed by the spec.
+void
+WebAssemblyMemory::CheckBulkMemoryRange(uint32 index, uint32 count, uint64 length) const
+{
+    if ((uint64)index + count > length)
+    {
+        JavascriptError::ThrowWebAssemblyRuntimeError(GetScriptContext(), WASMERR_ArrayIndexOutOfRange);
+    }
+}
+
+void
+WebAssemblyMemory::Copy(uint32 dst, uint32 src, uint32 count)
+{
+    const uint32 length = m_buffer->GetByteLength();
+    CheckBulkMemoryRange(dst, count, length);
+    CheckBulkMemoryRange(src, count, length);
+    if (count > 0)
+    {
+        BYTE* buffer = m_buffer->GetBuffer();
+        memmove_s(buffer + dst, length - dst, buffer + src, count);
+    }
+}
+
+void
+WebAssemblyMemory::Fill(uint32 dst, int32 value, uint32 count)
+{
+    const uint32 length = m_buffer->GetByteLength();
+    CheckBulkMemoryRange(dst, count, length);
+    if (count > 0)
+    {
+        memset(m_buffer->GetBuffer() + dst, (byte)value, count);
+    }
+}
+
+void
+WebAssemblyMemory::Init(Wasm::WasmDataSegment* segment, uint32 dst, uint32 src, uint32 count)
+{
+    // Dropped segments, and active segments which are dropped on instantiation, behave as empty segments
+    const uint32 segmentLength = segment ? segment->GetSourceSize() : 0;
+    const uint32 length = m_buffer->GetByteLength();
+    CheckBulkMemoryRange(src, count, segmentLength);
+    CheckBulkMemoryRange(dst, count, length);
+    if (count > 0)
+    {
+        js_memcpy_s(m_buffer->GetBuffer() + dst, length - dst, segment->GetData() + src, count);
+    }
+}
+
+void
+WebAssemblyMemory::CopyHelper(WebAssemblyMemory * mem, uint32 dst, uint32 src, uint32 count)
+{
+    JIT_HELPER_NOT_REENTRANT_NOLOCK_HEADER(Op_WasmMemoryCopy);
+    mem->Copy(dst, src, count);
+    JIT_HELPER_END(Op_WasmMemoryCopy);
+}
+
+void
+WebAssemblyMemory::FillHelper(WebAssemblyMemory * mem, uint32 dst, int32 value, uint32 count)
+{
+    JIT_HELPER_NOT_REENTRANT_NOLOCK_HEADER(Op_WasmMemoryFill);
+    mem->Fill(dst, value, count);
+    JIT_HELPER_END(Op_WasmMemoryFill);
+}
+
+void
+WebAssemblyMemory::InitHelper(Field(Var)* moduleEnv, uint32 segIndex, uint32 dst, uint32 src, uint32 count)
+{
+    JIT_HELPER_NOT_REENTRANT_NOLOCK_HEADER(Op_WasmMemoryInit);
+    WebAssemblyMemory* mem = VarTo<WebAssemblyMemory>(moduleEnv[WebAssemblyModule::GetMemoryOffset()]);
+    Wasm::WasmDataSegment** segments = WebAssemblyEnvironment::GetDataSegments(moduleEnv);
+    mem->Init(segments ? segments[segIndex] : nullptr, dst, src, count);
+    JIT_HELPER_END(Op_WasmMemoryInit);
+}
+
+void
+WebAssemblyMemory::DataDropHelper(Field(Var)* moduleEnv, uint32 segIndex)
+{
+    JIT_HELPER_NOT_REENTRANT_NOLOCK_HEADER(Op_WasmDataDrop);
+    Wasm::WasmDataSegment** segments = WebAssemblyEnvironment::GetDataSegments(moduleEnv);
+    if (segments)
+    {
+        segments[segIndex] = nullptr;
+    }
+    JIT_HELPER_END(Op_WasmDataDrop);
+}
+
 #if DBG
 void WebAssemblyMemory::TraceMemWrite(WebAssemblyMemory* mem, uint32 index, uint32 offset, Js::ArrayBufferView::ViewType viewType, uint32 bytecodeOffset, ScriptContext* context)
 {
@@ -269,7 +358,7 @@ WebAssemblyMemory::EntryGetterBuffer(RecyclableObject* function, CallInfo callIn
 }
 
 WebAssemblyMemory *
-WebAssemblyMemory::CreateMemoryObject(uint32 initial, uint32 maximum, bool isShared, ScriptContext * scriptContext)
+WebAssemblyMemory::CreateMemoryObject(uint32 initial, uint32 maximum, bool hasMaximum, bool isShared, ScriptContext * scriptContext)
 {
     if (!AreLimitsValid(initial, maximum))
     {
@@ -287,7 +376,12 @@ WebAssemblyMemory::CreateMemoryObject(uint32 initial, uint32 maximum, bool isSha
     else
 #endif
     {
-        buffer = scriptContext->GetLibrary()->CreateWebAssemblyArrayBuffer(byteLength);
+        // Reserve up to a declared maximum so the memory always grows in place. Without one, reserving up to the
+        // ArrayBuffer limit costs too much address space (and page bookkeeping in the PAL) for every memory,
+        // start small instead and let the buffer move to a larger reservation as it grows.
+        const uint32 maxPages = min(maximum, (uint32)(ArrayBuffer::MaxArrayBufferLength / WebAssembly::PageSize));
+        const uint32 reservedPages = hasMaximum ? maxPages : min(InitialReservedPages, maxPages);
+        buffer = scriptContext->GetLibrary()->CreateWebAssemblyArrayBuffer(byteLength, max(byteLength, UInt32Math::Mul<WebAssembly::PageSize>(reservedPages)));
     }
     Assert(buffer);
     if (byteLength > 0 && buffer->GetByteLength() == 0)
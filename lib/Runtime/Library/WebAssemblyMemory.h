@@ -5,6 +5,11 @@
 
 #pragma once
 
+namespace Wasm
+{
+    class WasmDataSegment;
+}
+
 namespace Js
 {
     class WebAssemblyMemory : public DynamicObject
@@ -27,7 +32,7 @@ namespace Js
         static Var EntryGrow(RecyclableObject* function, CallInfo callInfo, ...);
         static Var EntryGetterBuffer(RecyclableObject* function, CallInfo callInfo, ...);
 
-        static WebAssemblyMemory * CreateMemoryObject(uint32 initial, uint32 maximum, bool isShared, ScriptContext * scriptContext);
+        static WebAssemblyMemory * CreateMemoryObject(uint32 initial, uint32 maximum, bool hasMaximum, bool isShared, ScriptContext * scriptContext);
         static WebAssemblyMemory * CreateForExistingBuffer(uint32 initial, uint32 maximum, uint32 currentByteLength, ScriptContext * scriptContext);
 #ifdef ENABLE_WASM_THREADS
         static WebAssemblyMemory * CreateFromSharedContents(uint32 initial, uint32 maximum, SharedContents* sharedContents, ScriptContext * scriptContext);
@@ -44,14 +49,27 @@ namespace Js
         int32 GrowInternal(uint32 deltaPages);
         static int32 GrowHelper(Js::WebAssemblyMemory * memory, uint32 deltaPages);
 
+        // Bulk memory operators, throw a WebAssembly.RuntimeError when out of bounds
+        void Copy(uint32 dst, uint32 src, uint32 count);
+        void Fill(uint32 dst, int32 value, uint32 count);
+        void Init(Wasm::WasmDataSegment* segment, uint32 dst, uint32 src, uint32 count);
+        static void CopyHelper(Js::WebAssemblyMemory * memory, uint32 dst, uint32 src, uint32 count);
+        static void FillHelper(Js::WebAssemblyMemory * memory, uint32 dst, int32 value, uint32 count);
+        static void InitHelper(Field(Var)* moduleEnv, uint32 segIndex, uint32 dst, uint32 src, uint32 count);
+        static void DataDropHelper(Field(Var)* moduleEnv, uint32 segIndex);
+
         static int GetOffsetOfArrayBuffer() { return offsetof(WebAssemblyMemory, m_buffer); }
 #if DBG
         static void TraceMemWrite(WebAssemblyMemory* mem, uint32 index, uint32 offset, Js::ArrayBufferView::ViewType viewType, uint32 bytecodeOffset, ScriptContext* context);
 #endif
     private:
+        // Address space reserved for a memory without a declared maximum, the reservation doubles as the memory grows
+        static const uint32 InitialReservedPages = 16;
+
         WebAssemblyMemory(ArrayBufferBase* buffer, uint32 initial, uint32 maximum, DynamicType * type);
         static _Must_inspect_result_ bool AreLimitsValid(uint32 initial, uint32 maximum);
         static _Must_inspect_result_ bool AreLimitsValid(uint32 initial, uint32 maximum, uint32 bufferLength);
+        void CheckBulkMemoryRange(uint32 index, uint32 count, uint64 length) const;
 
         Field(ArrayBufferBase*) m_buffer;
 
@@ -17,6 +17,7 @@ WebAssemblyModule::WebAssemblyModule(Js::ScriptContext* scriptContext, const byt
     m_hasMemory(false),
     m_hasTable(false),
     m_memoryIsShared(false),
+    m_memoryHasMaximum(false),
     m_memImport(nullptr),
     m_tableImport(nullptr),
     m_importedFunctionCount(0),
@@ -28,6 +29,7 @@ WebAssemblyModule::WebAssemblyModule(Js::ScriptContext* scriptContext, const byt
     m_exports(nullptr),
     m_exportCount(0),
     m_datasegCount(0),
+    m_dataCount(Js::Constants::UninitializedValue),
     m_elementsegCount(0),
     m_elementsegs(nullptr),
     m_signatures(nullptr),
@@ -338,6 +340,7 @@ WebAssemblyModule::InitializeMemory(_In_ Wasm::MemorySectionLimits* memoryLimits
     }
 
     m_memoryIsShared = Wasm::Threads::IsEnabled() && memoryLimits->IsShared();
+    m_memoryHasMaximum = memoryLimits->HasMaximum();
     m_hasMemory = true;
     m_memoryInitSize = minPage;
     m_memoryMaxSize = maxPage;
@@ -349,6 +352,7 @@ WebAssemblyModule::CreateMemory() const
     return WebAssemblyMemory::CreateMemoryObject(
         m_memoryInitSize,
         m_memoryMaxSize,
+        m_memoryHasMaximum,
         m_memoryIsShared,
         GetScriptContext()
     );
@@ -847,8 +851,8 @@ uint32
 WebAssemblyModule::GetModuleEnvironmentSize() const
 {
     static const uint DOUBLE_SIZE_IN_INTS = sizeof(double) / sizeof(int);
-    // 1 each for memory, table, and signatures
-    uint32 size = 3;
+    // 1 each for memory, data segments, table, and signatures
+    uint32 size = 4;
     size = UInt32Math::Add(size, GetWasmFunctionCount());
     size = UInt32Math::Add(size, GetImportedFunctionCount());
     size = UInt32Math::Add(size, WAsmJs::ConvertOffset<byte, Js::Var>(GetGlobalsByteSize()));
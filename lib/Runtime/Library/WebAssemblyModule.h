@@ -122,6 +122,9 @@ class WebAssemblyModule : public DynamicObject
     void SetDataSeg(Wasm::WasmDataSegment* seg, uint32 index);
     Wasm::WasmDataSegment* GetDataSeg(uint32 index) const;
     uint32 GetDataSegCount() const { return m_datasegCount; }
+    void SetDataCount(uint32 count) { m_dataCount = count; }
+    bool HasDataCount() const { return m_dataCount != Js::Constants::UninitializedValue; }
+    uint32 GetDataCount() const { Assert(HasDataCount()); return m_dataCount; }
 
     void AllocateElementSegs(uint32 count);
     void SetElementSeg(Wasm::WasmElementSegment* seg, uint32 index);
@@ -135,7 +138,8 @@ class WebAssemblyModule : public DynamicObject
 
     // elements at known offsets
     static uint GetMemoryOffset() { return 0; }
-    static uint GetImportFuncOffset() { return GetMemoryOffset() + 1; }
+    static uint GetDataSegmentsOffset() { return GetMemoryOffset() + 1; }
+    static uint GetImportFuncOffset() { return GetDataSegmentsOffset() + 1; }
 
     // elements at instance dependent offsets
     uint GetFuncOffset() const { return GetImportFuncOffset() + GetImportedFunctionCount(); }
@@ -163,6 +167,7 @@ class WebAssemblyModule : public DynamicObject
     Field(bool) m_hasTable : 1;
     Field(bool) m_hasMemory : 1;
     Field(bool) m_memoryIsShared : 1;
+    Field(bool) m_memoryHasMaximum : 1;
     // The binary buffer is recycler allocated, tied the lifetime of the buffer to the module
     Field(const byte*) m_binaryBuffer;
     Field(uint) m_binaryBufferLength;
@@ -194,6 +199,7 @@ class WebAssemblyModule : public DynamicObject
     Field(uint) m_signaturesCount;
     Field(uint) m_exportCount;
     Field(uint32) m_datasegCount;
+    Field(uint32) m_dataCount;
     Field(uint32) m_elementsegCount;
 
     Field(uint32) m_startFuncIndex;
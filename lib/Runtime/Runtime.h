@@ -479,6 +479,7 @@ enum tagDEBUG_EVENT_INFO_TYPE
 
 #include "Base/StackProber.h"
 #include "Base/ScriptContextProfiler.h"
+#include "Base/StartupStats.h"
 
 #include "Language/JavascriptConversion.h"
 
@@ -64,7 +64,7 @@
 #define WASM_PREFIX_NUMERIC 0xfc
 #define WASM_PREFIX_THREADS 0xfe
 
-WASM_PREFIX(Numeric, WASM_PREFIX_NUMERIC, Wasm::WasmNontrapping::IsEnabled(), "WebAssembly nontrapping float-to-int conversion support is not enabled")
+WASM_PREFIX(Numeric, WASM_PREFIX_NUMERIC, Wasm::WasmNontrapping::IsEnabled() || Wasm::BulkMemory::IsEnabled(), "WebAssembly nontrapping float-to-int conversion and bulk memory support is not enabled")
 WASM_PREFIX(Threads, WASM_PREFIX_THREADS, Wasm::Threads::IsEnabled(), "WebAssembly Threads support is not enabled")
 #if ENABLE_DEBUG_CONFIG_OPTIONS
 // We won't even look at that prefix in release builds
@@ -100,6 +100,7 @@ WASM_SIGNATURE(D_L,     2,   WasmTypes::F64, WasmTypes::I64)
 WASM_SIGNATURE(D_ID,    3,   WasmTypes::F64, WasmTypes::I32, WasmTypes::F64)
 WASM_SIGNATURE(F_IF,    3,   WasmTypes::F32, WasmTypes::I32, WasmTypes::F32)
 WASM_SIGNATURE(L_IL,    3,   WasmTypes::I64, WasmTypes::I32, WasmTypes::I64)
+WASM_SIGNATURE(V_III,   4,   WasmTypes::Void, WasmTypes::I32, WasmTypes::I32, WasmTypes::I32)
 
 WASM_SIGNATURE(V_I,     2,   WasmTypes::Void, WasmTypes::I32)
 WASM_SIGNATURE(V_L,     2,   WasmTypes::Void, WasmTypes::I64)
@@ -317,6 +318,14 @@ WASM_UNARY__OPCODE(I64SatTruncU_F32, __prefix | 0x05, L_F, Conv_Sat_FTUL, __has_
 WASM_UNARY__OPCODE(I64SatTruncS_F64, __prefix | 0x06, L_D, Conv_Sat_DTL, __has_nontrapping, "i64.trunc_s:sat/f64")
 WASM_UNARY__OPCODE(I64SatTruncU_F64, __prefix | 0x07, L_D, Conv_Sat_DTUL, __has_nontrapping, "i64.trunc_u:sat/f64")
 #undef __has_nontrapping
+
+// Bulk memory operators
+#define __has_bulkmemory (Wasm::BulkMemory::IsEnabled())
+WASM_MISC_OPCODE(MemoryInit, __prefix | 0x08, V_III, __has_bulkmemory, "memory.init")
+WASM_MISC_OPCODE(DataDrop,   __prefix | 0x09, V, __has_bulkmemory, "data.drop")
+WASM_MISC_OPCODE(MemoryCopy, __prefix | 0x0a, V_III, __has_bulkmemory, "memory.copy")
+WASM_MISC_OPCODE(MemoryFill, __prefix | 0x0b, V_III, __has_bulkmemory, "memory.fill")
+#undef __has_bulkmemory
 #undef __prefix
 
 WASM_UNARY__OPCODE(F32SConvertI32,    0xb2, F_I , Fround_Int     , true, "f32.convert_s/i32")
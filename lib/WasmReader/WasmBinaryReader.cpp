@@ -102,6 +102,9 @@ bool WasmBinaryReader::ProcessCurrentSection()
     case bSectData:
         ReadDataSection();
         break;
+    case bSectDataCount:
+        ReadDataCountSection();
+        break;
     case bSectTable:
         ReadTableSection(false);
         break;
@@ -138,7 +141,7 @@ SectionHeader WasmBinaryReader::ReadSectionHeader()
     CompileAssert(sizeof(SectionCode) == sizeof(uint8));
     SectionCode sectionId = (SectionCode)LEB128<uint8, 7>(len);
 
-    if (sectionId > bsectLastKnownSection)
+    if (sectionId > bsectLastKnownSection || (sectionId == bSectDataCount && !BulkMemory::IsEnabled()))
     {
         ThrowDecodingError(_u("Invalid known section opcode %u"), sectionId);
     }
@@ -451,6 +454,33 @@ WasmOp WasmBinaryReader::ReadExpr()
         }
         break;
     }
+    case wbMemoryInit:
+    case wbDataDrop:
+    {
+        VarNode();
+        if (op == wbMemoryInit && ReadConst<uint8>() != 0)
+        {
+            ThrowDecodingError(_u("memory.init reserved value must be 0"));
+        }
+        break;
+    }
+    case wbMemoryCopy:
+    case wbMemoryFill:
+    {
+        // Reserved memory indices currently unused, memory.copy has one for each of the source and destination
+        const uint32 reservedCount = op == wbMemoryCopy ? 2 : 1;
+        for (uint32 i = 0; i < reservedCount; ++i)
+        {
+            if (ReadConst<uint8>() != 0)
+            {
+                ThrowDecodingError(op == wbMemoryCopy
+                    ? _u("memory.copy reserved value must be 0")
+                    : _u("memory.fill reserved value must be 0")
+                );
+            }
+        }
+        break;
+    }
 #ifdef ENABLE_WASM_SIMD
     case wbV8X16Shuffle:
         ShuffleNode();
@@ -781,7 +811,7 @@ void WasmBinaryReader::ReadSignatureTypeSection()
             WasmTypes::WasmType type = ReadWasmType(len);
             sig->SetResult(type, iResult);
         }
-        sig->FinalizeSignature();
+        sig->FinalizeSignature(m_module->GetScriptContext()->GetThreadContext());
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
         if (DO_WASM_TRACE_DECODER)
         {
@@ -1001,6 +1031,11 @@ void WasmBinaryReader::ReadDataSection()
         ThrowDecodingError(_u("Too many data segments"));
     }
 
+    if (m_module->HasDataCount() && numSegments != m_module->GetDataCount())
+    {
+        ThrowDecodingError(_u("Data segment count doesn't match the data count section"));
+    }
+
     if (numSegments > 0)
     {
         m_module->AllocateDataSegs(numSegments);
@@ -1008,22 +1043,59 @@ void WasmBinaryReader::ReadDataSection()
 
     for (uint32 i = 0; i < numSegments; ++i)
     {
-        uint32 index = LEB128(len);
-        if (index != 0 || !(m_module->HasMemory() || m_module->HasMemoryImport()))
+        // Without bulk memory this is the memory index, with bulk memory it is a set of flags
+        // 0: active segment for memory 0, 1: passive segment, 2: active segment with an explicit memory index
+        uint32 flags = LEB128(len);
+        bool isPassive = false;
+        uint32 index = flags;
+        if (BulkMemory::IsEnabled())
+        {
+            if (flags == 1)
+            {
+                isPassive = true;
+                index = 0;
+            }
+            else if (flags == 2)
+            {
+                index = LEB128(len);
+            }
+            else if (flags != 0)
+            {
+                ThrowDecodingError(_u("Invalid data segment flags %u"), flags);
+            }
+        }
+
+        if (index != 0 || (!isPassive && !(m_module->HasMemory() || m_module->HasMemoryImport())))
         {
             ThrowDecodingError(_u("Unknown memory index %u"), index);
         }
-        TRACE_WASM_DECODER(_u("Data Segment #%u"), i);
-        WasmNode initExpr = ReadInitExpr(true);
+        TRACE_WASM_DECODER(_u("Data Segment #%u%s"), i, isPassive ? _u(" (passive)") : _u(""));
+        WasmNode initExpr = {};
+        if (!isPassive)
+        {
+            initExpr = ReadInitExpr(true);
+        }
         uint32 dataByteLen = LEB128(len);
 
-        WasmDataSegment* dseg = Anew(m_alloc, WasmDataSegment, m_alloc, initExpr, dataByteLen, m_pc);
+        WasmDataSegment* dseg = Anew(m_alloc, WasmDataSegment, m_alloc, initExpr, dataByteLen, m_pc, isPassive);
         CheckBytesLeft(dataByteLen);
         m_pc += dataByteLen;
         m_module->SetDataSeg(dseg, i);
     }
 }
 
+void WasmBinaryReader::ReadDataCountSection()
+{
+    uint32 len = 0;
+    const uint32 dataCount = LEB128(len);
+    if (dataCount > Limits::GetMaxDataSegments())
+    {
+        ThrowDecodingError(_u("Too many data segments"));
+    }
+    TRACE_WASM_DECODER(_u("Data Count: %u"), dataCount);
+    m_module->SetDataCount(dataCount);
+}
+
 void WasmBinaryReader::ReadNameSection()
 {
     uint32 len = 0;
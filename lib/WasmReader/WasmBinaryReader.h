@@ -89,6 +89,7 @@ namespace Wasm
         void ReadExportSection();
         void ReadTableSection(bool isImportSection);
         void ReadDataSection();
+        void ReadDataCountSection();
         void ReadImportSection();
         void ReadStartFunction();
         void ReadNameSection();
@@ -249,6 +249,13 @@ WasmModuleGenerator::WasmModuleGenerator(Js::ScriptContext* scriptContext, Js::W
     m_sourceInfo->GetSrcInfo()->sourceContextInfo->EnsureInitialized();
 }
 
+// Known sections must appear in the order of their ids, except for the data count section which
+// has the highest id but must be placed between the element and the code sections
+static uint32 GetSectionOrder(SectionCode code)
+{
+    return code == bSectDataCount ? bSectFunctionBodies * 2 - 1 : code * 2;
+}
+
 Js::WebAssemblyModule* WasmModuleGenerator::GenerateModule()
 {
     Js::AutoProfilingPhase wasmPhase(m_scriptContext, Js::WasmReaderPhase);
@@ -258,7 +265,7 @@ Js::WebAssemblyModule* WasmModuleGenerator::GenerateModule()
 
     BVStatic<bSectLimit + 1> visitedSections;
 
-    SectionCode nextExpectedSection = bSectCustom;
+    uint32 nextExpectedSectionOrder = 0;
     while (true)
     {
         SectionHeader sectionHeader = GetReader()->ReadNextSection();
@@ -282,11 +289,12 @@ Js::WebAssemblyModule* WasmModuleGenerator::GenerateModule()
         // Custom section are allowed in any order
         if (sectionCode != bSectCustom)
         {
-            if (sectionCode < nextExpectedSection)
+            const uint32 sectionOrder = GetSectionOrder(sectionCode);
+            if (sectionOrder < nextExpectedSectionOrder)
             {
                 throw WasmCompilationException(_u("Invalid Section %s"), sectionHeader.name);
             }
-            nextExpectedSection = SectionCode(sectionCode + 1);
+            nextExpectedSectionOrder = sectionOrder + 1;
         }
 
         if (!GetReader()->ProcessCurrentSection())
@@ -295,6 +303,11 @@ Js::WebAssemblyModule* WasmModuleGenerator::GenerateModule()
         }
     }
 
+    if (m_module->HasDataCount() && m_module->GetDataCount() != m_module->GetDataSegCount())
+    {
+        throw WasmCompilationException(_u("Data segment count doesn't match the data count section"));
+    }
+
     uint32 funcCount = m_module->GetWasmFunctionCount();
     SourceContextInfo * sourceContextInfo = m_sourceInfo->GetSrcInfo()->sourceContextInfo;
     m_sourceInfo->EnsureInitialized(funcCount);
@@ -786,6 +799,14 @@ void WasmBytecodeGenerator::EmitExpr(WasmOp op)
         info = EmitGrowMemory();
         break;
     }
+    case wbMemoryInit:
+    case wbMemoryCopy:
+    case wbMemoryFill:
+        info = EmitBulkMemory(op);
+        break;
+    case wbDataDrop:
+        info = EmitDataDrop();
+        break;
     case wbUnreachable:
         m_writer->EmptyAsm(Js::OpCodeAsmJs::Unreachable_Void);
         SetUnreachableState(true);
@@ -1459,6 +1480,64 @@ EmitInfo WasmBytecodeGenerator::EmitGrowMemory()
     return info;
 }
 
+Js::RegSlot WasmBytecodeGenerator::EmitDataSegmentIndex()
+{
+    uint32 segIndex = GetReader()->m_currentNode.var.num;
+    if (!m_module->HasDataCount())
+    {
+        throw WasmCompilationException(_u("Data count section required"));
+    }
+    if (segIndex >= m_module->GetDataCount())
+    {
+        throw WasmCompilationException(_u("Invalid data segment index %u"), segIndex);
+    }
+
+    Js::RegSlot segReg = GetRegisterSpace(WasmTypes::I32)->AcquireTmpRegister();
+    m_writer->AsmInt1Const1(Js::OpCodeAsmJs::Ld_IntConst, segReg, (int32)segIndex);
+    return segReg;
+}
+
+EmitInfo WasmBytecodeGenerator::EmitBulkMemory(WasmOp op)
+{
+    SetUsesMemory(0);
+
+    EmitInfo countInfo = PopEvalStack(WasmTypes::I32, _u("Invalid type for bulk memory count"));
+    EmitInfo srcInfo = PopEvalStack(WasmTypes::I32, op == wbMemoryFill ? _u("Invalid type for memory.fill value") : _u("Invalid type for bulk memory source"));
+    EmitInfo dstInfo = PopEvalStack(WasmTypes::I32, _u("Invalid type for bulk memory destination"));
+
+    switch (op)
+    {
+    case wbMemoryInit:
+    {
+        EmitInfo segInfo(EmitDataSegmentIndex(), WasmTypes::I32);
+        m_writer->AsmReg4(Js::OpCodeAsmJs::MemoryInit, segInfo.location, dstInfo.location, srcInfo.location, countInfo.location);
+        ReleaseLocation(&segInfo);
+        break;
+    }
+    case wbMemoryCopy:
+        m_writer->AsmReg3(Js::OpCodeAsmJs::MemoryCopy, dstInfo.location, srcInfo.location, countInfo.location);
+        break;
+    case wbMemoryFill:
+        m_writer->AsmReg3(Js::OpCodeAsmJs::MemoryFill, dstInfo.location, srcInfo.location, countInfo.location);
+        break;
+    default:
+        Assume(UNREACHED);
+    }
+
+    ReleaseLocation(&countInfo);
+    ReleaseLocation(&srcInfo);
+    ReleaseLocation(&dstInfo);
+    return EmitInfo();
+}
+
+EmitInfo WasmBytecodeGenerator::EmitDataDrop()
+{
+    EmitInfo segInfo(EmitDataSegmentIndex(), WasmTypes::I32);
+    m_writer->AsmReg1(Js::OpCodeAsmJs::DataDrop, segInfo.location);
+    ReleaseLocation(&segInfo);
+    return EmitInfo();
+}
+
 EmitInfo WasmBytecodeGenerator::EmitDrop()
 {
     EmitInfo info = PopValuePolymorphic();
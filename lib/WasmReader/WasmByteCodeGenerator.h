@@ -218,6 +218,9 @@ namespace Wasm
         void EmitBrTable();
         EmitInfo EmitDrop();
         EmitInfo EmitGrowMemory();
+        EmitInfo EmitBulkMemory(WasmOp op);
+        EmitInfo EmitDataDrop();
+        Js::RegSlot EmitDataSegmentIndex();
         EmitInfo EmitGetLocal();
         EmitInfo EmitGetGlobal();
         EmitInfo EmitSetGlobal();
@@ -10,11 +10,12 @@
 namespace Wasm
 {
 
-WasmDataSegment::WasmDataSegment(ArenaAllocator* alloc, WasmNode ie, uint32 _source_size, const byte* _data) :
+WasmDataSegment::WasmDataSegment(ArenaAllocator* alloc, WasmNode ie, uint32 _source_size, const byte* _data, bool isPassive) :
     m_alloc(alloc),
     m_initExpr(ie),
     m_sourceSize(_source_size),
-    m_data(_data)
+    m_data(_data),
+    m_isPassive(isPassive)
 {
 }
 
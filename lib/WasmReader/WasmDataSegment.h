@@ -11,16 +11,19 @@ namespace Wasm
 class WasmDataSegment
 {
 public:
-    WasmDataSegment(ArenaAllocator* alloc, WasmNode initExpr, uint32 _source_size, const byte* _data);
-    WasmNode GetOffsetExpr() const { return m_initExpr; }
+    WasmDataSegment(ArenaAllocator* alloc, WasmNode initExpr, uint32 _source_size, const byte* _data, bool isPassive);
+    WasmNode GetOffsetExpr() const { Assert(!m_isPassive); return m_initExpr; }
     uint32 GetSourceSize() const;
     const byte* GetData() const;
+    // Passive segments are not copied on instantiation, only by memory.init
+    bool IsPassive() const { return m_isPassive; }
 
 private:
     ArenaAllocator* m_alloc;
     WasmNode m_initExpr;
     uint32 m_sourceSize;
     const byte* m_data;
+    bool m_isPassive;
 };
 
 } // namespace Wasm
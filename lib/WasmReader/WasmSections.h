@@ -16,5 +16,6 @@ WASM_SECTION(StartFunction  , "start"    , fSectNone  , Type      )
 WASM_SECTION(Element        , "element"  , fSectNone  , Limit     )
 WASM_SECTION(FunctionBodies , "code"     , fSectNone  , Function  )
 WASM_SECTION(Data           , "data"     , fSectNone  , Limit     )
+WASM_SECTION(DataCount      , "datacount", fSectNone  , Limit     )
 WASM_SECTION(Name           , "name"     , fSectIgnore, Type      )
 #undef WASM_SECTION
@@ -160,14 +160,8 @@ Js::ArgSlot WasmSignature::GetParamSize(Js::ArgSlot index) const
     }
 }
 
-void WasmSignature::FinalizeSignature()
+void WasmSignature::FinalizeSignature(ThreadContext * threadContext)
 {
-    if (GetResultCount() > 1)
-    {
-        // Do not support short signature with multiple returns at this time
-        return;
-    }
-    Local resultType = GetResultCount() == 1 ? GetResult(0) : WasmTypes::Void;
     Assert(m_paramSize == Js::Constants::InvalidArgSlot);
     Assert(m_shortSig == Js::Constants::InvalidSignature);
     const Js::ArgSlot paramCount = GetParamCount();
@@ -180,40 +174,47 @@ void WasmSignature::FinalizeSignature()
         }
     }
 
-    // 3 bits for result type, 3 for each arg
-    const uint32 nBitsForResult = 3;
+    // Do not support short signature with multiple returns at this time
+    if (GetResultCount() <= 1)
+    {
+        Local resultType = GetResultCount() == 1 ? GetResult(0) : WasmTypes::Void;
+
+        // 3 bits for result type, 3 for each arg
+        const uint32 nBitsForResult = 3;
 #ifdef ENABLE_WASM_SIMD
-    const uint32 nBitsForArgs = 3;
+        const uint32 nBitsForArgs = 3;
 #else
-    // We can drop 1 bit by excluding void
-    const uint32 nBitsForArgs = 2;
+        // We can drop 1 bit by excluding void
+        const uint32 nBitsForArgs = 2;
 #endif
-    CompileAssert(Local::Void == 0);
-    // Make sure we can encode all types (including void) with the number of bits reserved
-    CompileAssert(Local::Limit <= (1 << nBitsForResult));
-    // Make sure we can encode all types (excluding void) with the number of bits reserved
-    CompileAssert(Local::Limit - 1 <= (1 << nBitsForArgs));
-
-    ::Math::RecordOverflowPolicy sigOverflow;
-    const uint32 bitsRequiredForSig = UInt32Math::MulAdd<nBitsForArgs, nBitsForResult>((uint32)paramCount, sigOverflow);
-    if (sigOverflow.HasOverflowed())
-    {
-        return;
-    }
+        CompileAssert(Local::Void == 0);
+        // Make sure we can encode all types (including void) with the number of bits reserved
+        CompileAssert(Local::Limit <= (1 << nBitsForResult));
+        // Make sure we can encode all types (excluding void) with the number of bits reserved
+        CompileAssert(Local::Limit - 1 <= (1 << nBitsForArgs));
 
-    // we don't need to reserve a sentinel bit because there is no result type with value of 7
-    CompileAssert(Local::Limit <= 0b111);
-    const uint32 nAvailableBits = sizeof(m_shortSig) * 8;
-    if (bitsRequiredForSig <= nAvailableBits)
-    {
-        // Append the result type to the signature
-        m_shortSig = (m_shortSig << nBitsForResult) | resultType;
-        for (Js::ArgSlot i = 0; i < paramCount; ++i)
+        ::Math::RecordOverflowPolicy sigOverflow;
+        const uint32 bitsRequiredForSig = UInt32Math::MulAdd<nBitsForArgs, nBitsForResult>((uint32)paramCount, sigOverflow);
+
+        // we don't need to reserve a sentinel bit because there is no result type with value of 7
+        CompileAssert(Local::Limit <= 0b111);
+        // Keep the top bit set so short signatures never collide with the registry's keys
+        const uint32 nAvailableBits = sizeof(m_shortSig) * 8 - 1;
+        if (!sigOverflow.HasOverflowed() && bitsRequiredForSig <= nAvailableBits)
         {
-            // Append the param type to the signature, -1 to exclude Void
-            m_shortSig = (m_shortSig << nBitsForArgs) | (m_params[i] - 1);
+            // Append the result type to the signature
+            m_shortSig = (m_shortSig << nBitsForResult) | resultType;
+            for (Js::ArgSlot i = 0; i < paramCount; ++i)
+            {
+                // Append the param type to the signature, -1 to exclude Void
+                m_shortSig = (m_shortSig << nBitsForArgs) | (m_params[i] - 1);
+            }
+            Assert((intptr_t)m_shortSig < 0);
+            return;
         }
     }
+
+    m_shortSig = threadContext->GetWasmSignatureRegistry()->GetCanonicalKey(this);
 }
 
 Js::ArgSlot WasmSignature::GetParamsSize() const
@@ -311,6 +312,91 @@ void WasmSignature::Dump(uint32 maxlen)
 #endif
 }
 
+WasmSignatureRegistry::WasmSignatureRegistry(ArenaAllocator * alloc) :
+    alloc(alloc),
+    entries(alloc),
+    nextKey(0)
+{
+}
+
+size_t WasmSignatureRegistry::GetCanonicalKey(const WasmSignature * sig)
+{
+    const uint hash = GetHash(sig);
+    Entry * head = nullptr;
+    if (entries.TryGetValue(hash, &head))
+    {
+        for (Entry * entry = head; entry != nullptr; entry = entry->next)
+        {
+            if (IsMatch(entry, sig))
+            {
+                return entry->key;
+            }
+        }
+    }
+
+    // Short signatures have their top bit set
+    if ((intptr_t)nextKey < 0)
+    {
+        Js::Throw::OutOfMemory();
+    }
+
+    const uint32 resultsCount = sig->GetResultCount();
+    const Js::ArgSlot paramsCount = sig->GetParamCount();
+    Entry * entry = Anew(alloc, Entry);
+    entry->next = head;
+    entry->key = nextKey++;
+    entry->resultsCount = resultsCount;
+    entry->paramsCount = paramsCount;
+    entry->types = AnewArray(alloc, Local, UInt32Math::Add(resultsCount, paramsCount));
+    for (uint32 i = 0; i < resultsCount; ++i)
+    {
+        entry->types[i] = sig->GetResult(i);
+    }
+    for (Js::ArgSlot i = 0; i < paramsCount; ++i)
+    {
+        entry->types[resultsCount + i] = sig->GetParam(i);
+    }
+    entries.Item(hash, entry);
+    return entry->key;
+}
+
+uint WasmSignatureRegistry::GetHash(const WasmSignature * sig)
+{
+    uint hash = (sig->GetResultCount() << 16) ^ sig->GetParamCount();
+    for (uint32 i = 0; i < sig->GetResultCount(); ++i)
+    {
+        hash = hash * 31 + sig->GetResult(i);
+    }
+    for (Js::ArgSlot i = 0; i < sig->GetParamCount(); ++i)
+    {
+        hash = hash * 31 + sig->GetParam(i);
+    }
+    return hash;
+}
+
+bool WasmSignatureRegistry::IsMatch(const Entry * entry, const WasmSignature * sig)
+{
+    if (entry->resultsCount != sig->GetResultCount() || entry->paramsCount != sig->GetParamCount())
+    {
+        return false;
+    }
+    for (uint32 i = 0; i < entry->resultsCount; ++i)
+    {
+        if (entry->types[i] != sig->GetResult(i))
+        {
+            return false;
+        }
+    }
+    for (Js::ArgSlot i = 0; i < entry->paramsCount; ++i)
+    {
+        if (entry->types[entry->resultsCount + i] != sig->GetParam(i))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 } // namespace Wasm
 
 #endif // ENABLE_WASM
@@ -26,15 +26,15 @@ class WasmSignature
     uint32 GetResultCount() const { return m_resultsCount; }
     Local GetResult(uint32 index) const;
 
-    void FinalizeSignature();
+    void FinalizeSignature(ThreadContext * threadContext);
     uint32 GetSignatureId() const;
+    // Equal for two signatures iff they are equivalent; valid once the signature is finalized
     size_t GetShortSig() const;
 
     template<bool useShortSig = true>
     bool IsEquivalent(const WasmSignature* sig) const;
     static WasmSignature* FromIDL(WasmSignatureIDL* sig);
 
-    static uint32 GetOffsetOfShortSig() { return offsetof(WasmSignature, m_shortSig); }
 
     uint32 WriteSignatureToString(_Out_writes_(maxlen) char16 *out, uint32 maxlen);
     void Dump(uint32 maxlen = 512);
@@ -48,4 +48,31 @@ class WasmSignature
     Field(Local*) m_results = nullptr;
 };
 
+// Hands out the keys of the signatures that don't fit in a packed short signature
+// (too many params or multiple results), so call_indirect can always check the
+// callee with a single compare. Keys are unique per thread context.
+class WasmSignatureRegistry
+{
+public:
+    WasmSignatureRegistry(ArenaAllocator * alloc);
+    size_t GetCanonicalKey(const WasmSignature * sig);
+
+private:
+    struct Entry
+    {
+        Entry * next;
+        size_t key;
+        uint32 resultsCount;
+        Js::ArgSlot paramsCount;
+        Local * types; // results followed by params
+    };
+
+    static uint GetHash(const WasmSignature * sig);
+    static bool IsMatch(const Entry * entry, const WasmSignature * sig);
+
+    ArenaAllocator * alloc;
+    JsUtil::BaseDictionary<uint, Entry *, ArenaAllocator> entries;
+    size_t nextKey;
+};
+
 } // namespace Wasm
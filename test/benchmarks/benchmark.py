@@ -0,0 +1,243 @@
+#!/usr/bin/env python
+#-------------------------------------------------------------------------------------------------------
+# Copyright (C) Microsoft. All rights reserved.
+# Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+#-------------------------------------------------------------------------------------------------------
+
+# Cross-platform statistical benchmark runner for ch.
+#
+# Every sample is taken in a fresh ch process (process isolation), optionally pinned
+# to a single CPU. The first --warmup samples of every test are discarded; the rest
+# are summarized as a mean with a 95% confidence interval (Student's t) and written
+# to a JSON results file that compare.py can diff against another build.
+
+from __future__ import print_function
+from datetime import datetime
+import argparse
+import json
+import os
+import platform
+import re
+import subprocess as SP
+import sys
+import time
+
+from benchstats import communicate_with_timeout, summarize
+
+SCRIPT_DIR = os.path.dirname(os.path.realpath(__file__))
+RESULTS_FORMAT_VERSION = 1
+
+class Suite(object):
+    # metric is 'score' (bigger is better) or 'time' (smaller is better, ms)
+    def __init__(self, name, directory, tests, metric, flags=None, cwd=False):
+        self.name = name
+        self.directory = directory
+        self.tests = tests
+        self.metric = metric
+        self.flags = flags or []
+        # run ch from inside the suite directory (suites that load sibling files)
+        self.cwd = cwd
+
+    def bigger_is_better(self):
+        return self.metric == 'score'
+
+RE_TIME = re.compile(r'###\sTIME:\s(\d+(?:\.\d+)*)\sms')
+RE_SCORE = re.compile(r'###\sSCORE:\s(\d+(?:\.\d+)*)')
+RE_ARES_SUMMARY = re.compile(r'^summary:\s+(\d+(?:\.\d+)*)')
+
+SUITES = dict((s.name, s) for s in [
+    Suite('octane', 'Octane',
+        ['box2d', 'code-load', 'crypto', 'deltablue', 'earley-boyer', 'gbemu', 'mandreel',
+         'navier-stokes', 'pdfjs', 'raytrace', 'regexp', 'richards', 'splay', 'typescript', 'zlib'],
+        'score'),
+    Suite('kraken', 'Kraken',
+        ['ai-astar', 'audio-beat-detection', 'audio-dft', 'audio-fft', 'audio-oscillator',
+         'imaging-darkroom', 'imaging-desaturate', 'imaging-gaussian-blur', 'json-parse-financial',
+         'json-stringify-tinderbox', 'stanford-crypto-aes', 'stanford-crypto-ccm',
+         'stanford-crypto-pbkdf2', 'stanford-crypto-sha256-iterative'],
+        'time'),
+    Suite('sunspider', 'SunSpider',
+        ['3d-cube', '3d-morph', '3d-raytrace', 'access-binary-trees', 'access-fannkuch',
+         'access-nbody', 'access-nsieve', 'bitops-3bit-bits-in-byte', 'bitops-bits-in-byte',
+         'bitops-bitwise-and', 'bitops-nsieve-bits', 'controlflow-recursive', 'crypto-aes',
+         'crypto-md5', 'crypto-sha1', 'date-format-tofte', 'date-format-xparb', 'math-cordic',
+         'math-partial-sums', 'math-spectral-norm', 'regexp-dna', 'string-base64', 'string-fasta',
+         'string-tagcloud', 'string-unpack-code', 'string-validate-input'],
+        'time', flags=['-highprecisiondate']),
+    Suite('jetstream', 'jetstream',
+        ['bigfib.cpp', 'container.cpp', 'dry.c', 'float-mm.c', 'gcc-loops.cpp', 'hash-map',
+         'n-body.c', 'quicksort.c', 'towers.c', 'cdjs'],
+        'score'),
+    # ARES-6 runs its own driver; we record the geomean "summary" line in ms
+    Suite('ares6', 'ARES-6', ['cli'], 'time', cwd=True),
+])
+
+VARIANTS = {
+    'native': [],
+    'interpreted': ['-NoNative'],
+}
+
+parser = argparse.ArgumentParser(
+    description='ChakraCore statistical benchmark runner',
+    formatter_class=argparse.RawDescriptionHelpFormatter,
+    epilog='''\
+Samples:
+
+run every suite and write results.json:
+    benchmark.py -b out/Release/ch -o results.json
+
+run two Octane tests with 20 samples pinned to CPU 2:
+    benchmark.py -b out/Release/ch -s octane -t richards deltablue -n 20 --cpu 2
+
+compare against a baseline:
+    compare.py base.json results.json
+''')
+parser.add_argument('-b', '--binary', metavar='bin', required=True,
+                    help='ch full path')
+parser.add_argument('-s', '--suites', metavar='suite', nargs='+',
+                    choices=sorted(SUITES.keys()), default=None,
+                    help='suites to run (default: all)')
+parser.add_argument('-t', '--tests', metavar='test', nargs='+', default=None,
+                    help='only run tests with these names')
+parser.add_argument('-n', '--iterations', type=int, default=10,
+                    help='measured samples per test (default 10)')
+parser.add_argument('-w', '--warmup', type=int, default=1,
+                    help='discarded warmup samples per test (default 1)')
+parser.add_argument('--variants', metavar='variant', nargs='+',
+                    choices=sorted(VARIANTS.keys()), default=['native'],
+                    help='ch variants to run (default: native)')
+parser.add_argument('--cpu', type=int, default=None,
+                    help='pin every ch process to this CPU')
+parser.add_argument('--flags', default='',
+                    help='extra flags passed to ch')
+parser.add_argument('--timeout', type=int, default=600,
+                    help='per-process timeout in seconds (default 600)')
+parser.add_argument('-o', '--output', metavar='file', default='benchmark-results.json',
+                    help='JSON results file (default benchmark-results.json)')
+parser.add_argument('-v', '--verbose', action='store_true',
+                    help='print every sample')
+def pin_to_cpu():
+    if args.cpu is not None and hasattr(os, 'sched_setaffinity'):
+        os.sched_setaffinity(0, [args.cpu])
+
+def build_command(suite, test, variant):
+    cmd = []
+    if args.cpu is not None and not hasattr(os, 'sched_setaffinity'):
+        # python2 / non-linux: fall back to taskset if we have it
+        cmd += ['taskset', '-c', str(args.cpu)]
+    cmd.append(os.path.realpath(args.binary))
+    cmd += VARIANTS[variant]
+    cmd += suite.flags
+    cmd += args.flags.split()
+    if suite.cwd:
+        cmd.append(test + '.js')
+    else:
+        cmd.append(os.path.join(SCRIPT_DIR, suite.directory, test + '.js'))
+    return cmd
+
+def parse_output(suite, output):
+    value = None
+    for line in output.splitlines():
+        line = line.strip()
+        if suite.name == 'ares6':
+            match = RE_ARES_SUMMARY.match(line)
+        elif suite.metric == 'score':
+            match = RE_SCORE.search(line)
+        else:
+            match = RE_TIME.search(line)
+        if match:
+            # keep the last one; ARES-6 prints a running summary
+            value = float(match.group(1))
+    return value
+
+def run_once(suite, test, variant):
+    cmd = build_command(suite, test, variant)
+    cwd = os.path.join(SCRIPT_DIR, suite.directory) if suite.cwd else None
+    start = time.time()
+    proc = SP.Popen(cmd, stdout=SP.PIPE, stderr=SP.STDOUT, cwd=cwd,
+                    preexec_fn=pin_to_cpu if os.name == 'posix' else None)
+    output, timedout = communicate_with_timeout(proc, args.timeout)
+    if timedout:
+        raise RuntimeError('timed out after %d seconds: %s' % (args.timeout, ' '.join(cmd)))
+    wall = (time.time() - start) * 1000.0
+    output = output.decode('utf-8', 'replace')
+    if proc.returncode != 0:
+        raise RuntimeError('exit code %d: %s\n%s' % (proc.returncode, ' '.join(cmd), output))
+    value = parse_output(suite, output)
+    if value is None:
+        raise RuntimeError('no %s found in output: %s\n%s' % (suite.metric, ' '.join(cmd), output))
+    return value, wall
+
+def run_test(suite, test, variant):
+    for _ in range(args.warmup):
+        run_once(suite, test, variant)
+    values = []
+    walls = []
+    for i in range(args.iterations):
+        value, wall = run_once(suite, test, variant)
+        values.append(value)
+        walls.append(wall)
+        if args.verbose:
+            print('    #%d %s=%.2f wall=%.1fms' % (i + 1, suite.metric, value, wall))
+    return summarize(values), summarize(walls)
+
+def main():
+    if not os.path.isfile(args.binary):
+        print('ERROR: binary not found: ' + args.binary)
+        return 1
+    if args.iterations < 2:
+        print('ERROR: need at least 2 iterations to compute a confidence interval')
+        return 1
+
+    suites = [SUITES[name] for name in (args.suites or sorted(SUITES.keys()))]
+    results = {
+        'version': RESULTS_FORMAT_VERSION,
+        'binary': os.path.realpath(args.binary),
+        'date': datetime.now().isoformat(),
+        'host': platform.node(),
+        'platform': platform.platform(),
+        'iterations': args.iterations,
+        'warmup': args.warmup,
+        'cpu': args.cpu,
+        'flags': args.flags,
+        'tests': []
+    }
+
+    failed = 0
+    for variant in args.variants:
+        for suite in suites:
+            print('%s (%s, %s)' % (suite.name, variant, suite.metric))
+            for test in suite.tests:
+                if args.tests and test not in args.tests:
+                    continue
+                try:
+                    value, wall = run_test(suite, test, variant)
+                except RuntimeError as e:
+                    print('  %-32s FAILED' % test)
+                    print(str(e))
+                    failed += 1
+                    continue
+                print('  %-32s %10.2f +- %6.2f (%4.1f%%)' % (test, value['mean'], value['ci95'],
+                      100.0 * value['ci95'] / value['mean'] if value['mean'] else 0.0))
+                results['tests'].append({
+                    'suite': suite.name,
+                    'test': test,
+                    'variant': variant,
+                    'metric': suite.metric,
+                    'biggerIsBetter': suite.bigger_is_better(),
+                    'value': value,
+                    'wallTime': wall
+                })
+
+    with open(args.output, 'w') as f:
+        json.dump(results, f, indent=2, sort_keys=True)
+    print('Results written to ' + args.output)
+
+    if failed:
+        print('%d test(s) failed' % failed)
+        return 1
+    return 0
+
+if __name__ == '__main__':
+    args = parser.parse_args()
+    sys.exit(main())
@@ -0,0 +1,75 @@
+#-------------------------------------------------------------------------------------------------------
+# Copyright (C) Microsoft. All rights reserved.
+# Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+#-------------------------------------------------------------------------------------------------------
+
+# Sample statistics and process helpers shared by benchmark.py, jitbench.py and compare.py.
+
+from __future__ import division
+from threading import Timer
+import math
+
+# two-sided 95% critical values of Student's t, indexed by degrees of freedom
+T_TABLE_95 = [float('nan'),
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042]
+T_LIMIT_95 = 1.960
+
+def t_critical(df):
+    if df < 1:
+        return float('nan')
+    if df >= len(T_TABLE_95):
+        # 1/df interpolation between df=30 and infinity is accurate to ~0.1%
+        return T_LIMIT_95 + (T_TABLE_95[-1] - T_LIMIT_95) * (len(T_TABLE_95) - 1) / df
+    lo = int(math.floor(df))
+    hi = min(lo + 1, len(T_TABLE_95) - 1)
+    return T_TABLE_95[lo] + (T_TABLE_95[hi] - T_TABLE_95[lo]) * (df - lo)
+
+def summarize(samples):
+    n = len(samples)
+    if n == 0:
+        return None
+    mean = sum(samples) / float(n)
+    stddev = 0.0
+    ci = 0.0
+    if n > 1:
+        stddev = math.sqrt(sum((x - mean) ** 2 for x in samples) / (n - 1))
+        ci = t_critical(n - 1) * stddev / math.sqrt(n)
+    return {
+        'n': n,
+        'mean': mean,
+        'stddev': stddev,
+        'ci95': ci,
+        'min': min(samples),
+        'max': max(samples),
+        'samples': samples
+    }
+
+def welch(base, test):
+    # returns (difference of means, 95% half interval of the difference); the
+    # interval is None when either side has a single sample and no variance estimate
+    diff = test['mean'] - base['mean']
+    if base['n'] < 2 or test['n'] < 2:
+        return diff, None
+    va = base['stddev'] ** 2 / base['n']
+    vb = test['stddev'] ** 2 / test['n']
+    se = math.sqrt(va + vb)
+    if se == 0:
+        return diff, 0.0
+    df = (va + vb) ** 2 / ((va ** 2) / (base['n'] - 1) + (vb ** 2) / (test['n'] - 1))
+    return diff, t_critical(df) * se
+
+def communicate_with_timeout(proc, timeout):
+    # Popen.communicate(timeout=) is Python 3 only; kill from a timer like runtests.py does
+    timeout_data = [proc, False]
+    def timeout_func(timeout_data):
+        timeout_data[0].kill()
+        timeout_data[1] = True
+    timer = Timer(timeout, timeout_func, [timeout_data])
+    try:
+        timer.start()
+        output = proc.communicate()[0]
+    finally:
+        timer.cancel()
+    return output, timeout_data[1]
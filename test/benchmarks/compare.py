@@ -0,0 +1,85 @@
+#!/usr/bin/env python
+#-------------------------------------------------------------------------------------------------------
+# Copyright (C) Microsoft. All rights reserved.
+# Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+#-------------------------------------------------------------------------------------------------------
+
+# Compares two result files written by benchmark.py.
+#
+# A difference is reported as significant when the 95% confidence interval of the
+# difference of means (Welch's t-test, unequal variances) excludes zero AND the
+# relative change exceeds --threshold. Tests with fewer than two samples on either
+# side have no variance estimate and are never reported as significant. Exits with 1
+# if any test regressed.
+
+from __future__ import print_function
+import argparse
+import json
+import sys
+
+from benchstats import welch
+
+def load(path):
+    with open(path) as f:
+        data = json.load(f)
+    tests = {}
+    for entry in data['tests']:
+        tests[(entry['suite'], entry['test'], entry['variant'])] = entry
+    return data, tests
+
+parser = argparse.ArgumentParser(
+    description='Compare two ChakraCore benchmark result files')
+parser.add_argument('base', help='baseline results (benchmark.py -o)')
+parser.add_argument('test', help='results to compare against the baseline')
+parser.add_argument('--threshold', type=float, default=1.0,
+                    help='ignore changes smaller than this many percent (default 1.0)')
+parser.add_argument('--wall', action='store_true',
+                    help='compare process wall time instead of the reported metric')
+def main():
+    base_data, base = load(args.base)
+    test_data, test = load(args.test)
+    print('base: %s (%s)' % (base_data['binary'], base_data['date']))
+    print('test: %s (%s)' % (test_data['binary'], test_data['date']))
+    print()
+    print('%-10s %-32s %12s %12s %8s %8s' % ('SUITE', 'TEST', 'BASE', 'TEST', 'DIFF%', '+-%'))
+    print('-' * 88)
+
+    regressions = 0
+    improvements = 0
+    for key in sorted(base.keys()):
+        if key not in test:
+            continue
+        suite, name, variant = key
+        b = base[key]['wallTime' if args.wall else 'value']
+        t = test[key]['wallTime' if args.wall else 'value']
+        bigger_is_better = base[key]['biggerIsBetter'] and not args.wall
+        diff, interval = welch(b, t)
+        ratio = 100.0 * diff / b['mean'] if b['mean'] else 0.0
+
+        mark = ''
+        if interval is None:
+            ratio_interval = '%8s' % 'n/a'
+            mark = '(n<2)'
+        else:
+            ratio_interval = '%7.1f%%' % (100.0 * interval / b['mean'] if b['mean'] else 0.0)
+        if interval is not None and abs(diff) > interval and abs(ratio) >= args.threshold:
+            worse = diff < 0 if bigger_is_better else diff > 0
+            if worse:
+                mark = '<-REGRESSED'
+                regressions += 1
+            else:
+                mark = '<-IMPROVED'
+                improvements += 1
+
+        if variant != 'native':
+            name = '%s (%s)' % (name, variant)
+        print('%-10s %-32.32s %12.2f %12.2f %+7.1f%% %s %s' % (
+            suite, name, b['mean'], t['mean'], ratio, ratio_interval, mark))
+
+    print('-' * 88)
+    print('%d significant regression(s), %d significant improvement(s)' % (regressions, improvements))
+    return 1 if regressions else 0
+
+if __name__ == '__main__':
+    args = parser.parse_args()
+    sys.exit(main())
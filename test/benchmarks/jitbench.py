@@ -0,0 +1,435 @@
+#!/usr/bin/env python
+#-------------------------------------------------------------------------------------------------------
+# Copyright (C) Microsoft. All rights reserved.
+# Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+#-------------------------------------------------------------------------------------------------------
+
+# JIT compile-throughput benchmark.
+#
+# Runs a corpus of large scripts with every called function forced through the full
+# JIT on the main thread, and collects the per-phase backend time and peak JIT arena
+# usage printed by -Stats:BackEnd (needs a test or debug build of ch). The corpus is
+# built from the test/benchmarks sources (Octane files driven for a single iteration,
+# SunSpider and Kraken concatenated into bundles) plus synthetic functions sized to
+# stress individual phases.
+#
+# Results use the benchmark.py JSON format, so two runs can be diffed with compare.py.
+# With --history, a one-line summary per run is appended to a JSON lines file so the
+# numbers can be tracked over time (--trend prints it).
+
+from __future__ import print_function, unicode_literals
+from datetime import datetime
+import argparse
+import io
+import json
+import os
+import platform
+import re
+import shutil
+import subprocess as SP
+import sys
+import tempfile
+import time
+
+from benchstats import communicate_with_timeout, summarize
+
+SCRIPT_DIR = os.path.dirname(os.path.realpath(__file__))
+RESULTS_FORMAT_VERSION = 1
+
+# Phases reported by default. RegAlloc is the LinearScan register allocator.
+DEFAULT_PHASES = ['BackEnd', 'IRBuilder', 'Inline', 'FGBuild', 'GlobOpt', 'Lowerer', 'RegAlloc', 'Encoder']
+
+MODES = {
+    # JIT every function on its first call, skipping the simple JIT, on the main thread
+    'forcenative': ['-forceNative', '-off:simpleJit', '-bgjit-'],
+    # JIT every function up front, including ones that are never called
+    'prejit': ['-prejit', '-bgjit-'],
+}
+
+#
+# Corpus
+#
+
+OCTANE_BUNDLES = ['box2d', 'code-load', 'crypto', 'deltablue', 'earley-boyer', 'gbemu', 'mandreel',
+                  'navier-stokes', 'pdfjs', 'raytrace', 'regexp', 'richards', 'splay', 'typescript', 'zlib']
+
+# Run every Octane benchmark once instead of for the harness' minimum time; we only
+# want each function to be compiled, not a score.
+OCTANE_DRIVER = '''
+for (var i = 0; i < BenchmarkSuite.suites.length; i++) {
+  var benchmarks = BenchmarkSuite.suites[i].benchmarks;
+  for (var j = 0; j < benchmarks.length; j++) {
+    benchmarks[j].Setup();
+    benchmarks[j].run();
+    benchmarks[j].TearDown();
+  }
+}
+'''
+
+# Sources are copied byte for byte; not all of them are valid UTF-8
+SOURCE_ENCODING = 'latin-1'
+
+RE_OCTANE_RUNNER = re.compile(r'^BenchmarkSuite\.RunSuites\(\{', re.MULTILINE)
+
+def build_octane(name, out):
+    with io.open(os.path.join(SCRIPT_DIR, 'Octane', name + '.js'), encoding=SOURCE_ENCODING) as f:
+        source = f.read()
+    runners = list(RE_OCTANE_RUNNER.finditer(source))
+    if runners:
+        source = source[:runners[-1].start()] + OCTANE_DRIVER
+    out.write(source)
+
+def build_concat(directory):
+    # Each file runs in its own function scope so top level declarations don't collide
+    def build(out):
+        for name in sorted(os.listdir(os.path.join(SCRIPT_DIR, directory))):
+            if not name.endswith('.js'):
+                continue
+            with io.open(os.path.join(SCRIPT_DIR, directory, name), encoding=SOURCE_ENCODING) as f:
+                out.write('// %s\n(function () {\n%s\n})();\n' % (name, f.read()))
+    return build
+
+# Synthetic functions. Each is called once; size scales with --scale.
+
+def synth_straightline(scale):
+    # One very large basic block: stresses IRBuilder, GlobOpt value numbering and the encoder
+    def build(out):
+        statements = 2000 * scale
+        out.write('function straightline(a, b) {\n  var x0 = a, x1 = b, x2 = a + b, x3 = a - b;\n')
+        for i in range(statements):
+            d, s1, s2 = i % 4, (i + 1) % 4, (i + 2) % 4
+            op = ['+', '-', '*', '|', '^', '&'][i % 6]
+            out.write('  x%d = (x%d %s x%d) + %d;\n' % (d, s1, op, s2, i))
+        out.write('  return x0 + x1 + x2 + x3;\n}\nstraightline(1, 2);\n')
+    return build
+
+def synth_loops(scale):
+    # Deep loop nests over arrays: stresses loop prepass, bound check hoisting and induction variables
+    def build(out):
+        out.write('var arr = new Array(64); for (var k = 0; k < 64; k++) arr[k] = k;\n')
+        for f in range(50 * scale):
+            out.write('function loops%d(a) {\n  var sum = 0;\n' % f)
+            out.write('  for (var i = 0; i < 4; i++) {\n    for (var j = 0; j < 4; j++) {\n')
+            out.write('      for (var k = 0; k < 4; k++) {\n')
+            for s in range(8):
+                out.write('        sum += a[(i * 16 + j * 4 + k + %d) & 63] * %d;\n' % (s, s + 1))
+            out.write('        if (sum > 1e9) { sum = 0; }\n      }\n    }\n  }\n  return sum;\n}\n')
+            out.write('loops%d(arr);\n' % f)
+    return build
+
+def synth_switch(scale):
+    # Large switch: stresses the switch optimizer, flow graph and register allocation
+    def build(out):
+        cases = 1000 * scale
+        out.write('function bigswitch(v) {\n  var r = 0;\n  switch (v) {\n')
+        for i in range(cases):
+            out.write('  case %d: r = v * %d + %d; break;\n' % (i, i % 7 + 1, i))
+        out.write('  default: r = -1;\n  }\n  return r;\n}\n')
+        out.write('for (var i = 0; i < 16; i++) bigswitch(i * 37);\n')
+    return build
+
+def synth_liveranges(scale):
+    # Many simultaneously live values: stresses LinearScan spilling
+    def build(out):
+        values = 200 * scale
+        out.write('function liveranges(a) {\n')
+        for i in range(values):
+            out.write('  var v%d = a * %d + %d;\n' % (i, i + 1, i))
+        out.write('  var sum = 0;\n  for (var n = 0; n < 2; n++) {\n')
+        for i in range(values):
+            out.write('    sum += v%d;\n' % i)
+        out.write('  }\n  return sum;\n}\nliveranges(3);\n')
+    return build
+
+def synth_manyfunctions(scale):
+    # Many small functions: measures per-function fixed cost of a compile
+    def build(out):
+        count = 2000 * scale
+        for i in range(count):
+            out.write('function f%d(o) { return o.x + o.y * %d; }\n' % (i, i))
+        out.write('var o = { x: 1, y: 2 };\n')
+        for i in range(count):
+            out.write('f%d(o);\n' % i)
+    return build
+
+def synth_properties(scale):
+    # Property access across several shapes: stresses object type specialization
+    def build(out):
+        out.write('var shapes = [];\nfor (var s = 0; s < 8; s++) { var o = {}; o["p" + s] = s; o.a = 1; o.b = 2; o.c = 3; shapes.push(o); }\n')
+        for f in range(100 * scale):
+            out.write('function props%d(o) {\n  var r = 0;\n' % f)
+            for p in range(20):
+                out.write('  r += o.%s; o.%s = r & 0xff;\n' % ('abc'[p % 3], 'abc'[(p + 1) % 3]))
+            out.write('  return r;\n}\nfor (var s = 0; s < shapes.length; s++) props%d(shapes[s]);\n' % f)
+    return build
+
+class CorpusEntry(object):
+    def __init__(self, name, build):
+        self.name = name
+        self.build = build
+        self.path = None
+
+def make_corpus(scale):
+    corpus = []
+    for name in OCTANE_BUNDLES:
+        corpus.append(CorpusEntry('octane-' + name, lambda out, name=name: build_octane(name, out)))
+    corpus.append(CorpusEntry('sunspider-bundle', build_concat('SunSpider')))
+    corpus.append(CorpusEntry('kraken-bundle', build_concat('Kraken')))
+    corpus.append(CorpusEntry('synth-straightline', synth_straightline(scale)))
+    corpus.append(CorpusEntry('synth-loops', synth_loops(scale)))
+    corpus.append(CorpusEntry('synth-switch', synth_switch(scale)))
+    corpus.append(CorpusEntry('synth-liveranges', synth_liveranges(scale)))
+    corpus.append(CorpusEntry('synth-manyfunctions', synth_manyfunctions(scale)))
+    corpus.append(CorpusEntry('synth-properties', synth_properties(scale)))
+    return corpus
+
+#
+# Arguments
+#
+
+parser = argparse.ArgumentParser(
+    description='ChakraCore JIT compile-throughput benchmark',
+    formatter_class=argparse.RawDescriptionHelpFormatter,
+    epilog='''\
+Samples:
+
+run the whole corpus with a test build and track the results:
+    jitbench.py -b out/Test/ch -o jit.json --history jit-history.jsonl
+
+run the synthetic entries only, twice as large:
+    jitbench.py -b out/Test/ch -t synth- --scale 2
+
+compare against a baseline:
+    compare.py base-jit.json jit.json
+
+show the BackEnd time of every entry over the tracked runs:
+    jitbench.py --history jit-history.jsonl --trend BackEnd
+''')
+parser.add_argument('-b', '--binary', metavar='bin',
+                    help='ch full path (test or debug build)')
+parser.add_argument('-t', '--tests', metavar='prefix', nargs='+', default=None,
+                    help='only run corpus entries whose name starts with one of these')
+parser.add_argument('-n', '--iterations', type=int, default=5,
+                    help='measured samples per entry (default 5)')
+parser.add_argument('-w', '--warmup', type=int, default=1,
+                    help='discarded warmup samples per entry (default 1)')
+parser.add_argument('-m', '--mode', choices=sorted(MODES.keys()), default='forcenative',
+                    help='how functions are forced through the JIT (default forcenative)')
+parser.add_argument('-p', '--phases', metavar='phase', nargs='+', default=DEFAULT_PHASES,
+                    help='phases to report (default: %s)' % ' '.join(DEFAULT_PHASES))
+parser.add_argument('--scale', type=int, default=1,
+                    help='size multiplier for synthetic entries (default 1)')
+parser.add_argument('--corpus-dir', metavar='dir', default=None,
+                    help='write the generated corpus here and keep it (default: temporary)')
+parser.add_argument('--flags', default='',
+                    help='extra flags passed to ch')
+parser.add_argument('--timeout', type=int, default=600,
+                    help='per-process timeout in seconds (default 600)')
+parser.add_argument('-o', '--output', metavar='file', default='jitbench-results.json',
+                    help='JSON results file (default jitbench-results.json)')
+parser.add_argument('--history', metavar='file', default=None,
+                    help='append a summary of this run to a JSON lines history file')
+parser.add_argument('--trend', metavar='phase', default=None,
+                    help='print the mean time of a phase from --history and exit')
+parser.add_argument('-v', '--verbose', action='store_true',
+                    help='print every sample')
+#
+# Running
+#
+
+RE_STATS_HEADER = re.compile(r'^JIT Phase Stats')
+RE_STATS_LINE = re.compile(r'^(\w+)\s+(\d+)\s+([\d.]+)\s+([\d.]+)\s+([\d.]+)\s+([\d.]+)\s+([\d.]+)\s*$')
+
+def parse_stats(output):
+    # A block is printed per script context; merge them
+    phases = {}
+    in_block = False
+    for line in output.splitlines():
+        if RE_STATS_HEADER.match(line):
+            in_block = True
+            continue
+        if not in_block:
+            continue
+        match = RE_STATS_LINE.match(line)
+        if not match:
+            continue
+        name = match.group(1)
+        count = int(match.group(2))
+        phase = phases.setdefault(name, {'count': 0, 'totalMs': 0.0, 'maxMs': 0.0, 'peakKBSum': 0.0, 'maxPeakKB': 0.0})
+        phase['count'] += count
+        phase['totalMs'] += float(match.group(3))
+        phase['maxMs'] = max(phase['maxMs'], float(match.group(5)))
+        phase['peakKBSum'] += float(match.group(6)) * count
+        phase['maxPeakKB'] = max(phase['maxPeakKB'], float(match.group(7)))
+    return phases
+
+def run_once(entry):
+    cmd = [os.path.realpath(args.binary), '-Stats:BackEnd'] + MODES[args.mode] + args.flags.split() + [entry.path]
+    start = time.time()
+    proc = SP.Popen(cmd, stdout=SP.PIPE, stderr=SP.STDOUT, cwd=os.path.dirname(entry.path))
+    output, timedout = communicate_with_timeout(proc, args.timeout)
+    if timedout:
+        raise RuntimeError('timed out after %d seconds: %s' % (args.timeout, ' '.join(cmd)))
+    wall = (time.time() - start) * 1000.0
+    output = output.decode('utf-8', 'replace')
+    if proc.returncode != 0:
+        raise RuntimeError('exit code %d: %s\n%s' % (proc.returncode, ' '.join(cmd), output[-4000:]))
+    phases = parse_stats(output)
+    if 'BackEnd' not in phases:
+        raise RuntimeError('no JIT phase stats in output (is %s a test or debug build?): %s'
+                           % (args.binary, ' '.join(cmd)))
+    return phases, wall
+
+def run_entry(entry):
+    for _ in range(args.warmup):
+        run_once(entry)
+    times = dict((phase, []) for phase in args.phases)
+    peaks = dict((phase, []) for phase in args.phases)
+    walls = []
+    functions = 0
+    for i in range(args.iterations):
+        phases, wall = run_once(entry)
+        walls.append(wall)
+        functions = phases['BackEnd']['count']
+        for phase in args.phases:
+            data = phases.get(phase)
+            times[phase].append(data['totalMs'] if data else 0.0)
+            peaks[phase].append(data['maxPeakKB'] if data else 0.0)
+        if args.verbose:
+            print('    #%d BackEnd=%.2fms peak=%.1fKB wall=%.1fms' % (
+                i + 1, phases['BackEnd']['totalMs'], phases['BackEnd']['maxPeakKB'], wall))
+    return functions, times, peaks, summarize(walls)
+
+def print_trend(phase):
+    with open(args.history) as f:
+        runs = [json.loads(line) for line in f if line.strip()]
+    if not runs:
+        print('no runs in ' + args.history)
+        return 0
+    names = sorted(set(name for run in runs for name in run['entries']))
+    print('%s time (ms) per run' % phase)
+    print('%-24s %-12s %s' % ('DATE', 'REVISION', ' '.join('%12.12s' % name for name in names)))
+    for run in runs:
+        cells = []
+        for name in names:
+            value = run['entries'].get(name, {}).get(phase)
+            cells.append('%12.2f' % value if value is not None else '%12s' % '-')
+        print('%-24.24s %-12.12s %s' % (run['date'], run.get('revision') or '-', ' '.join(cells)))
+    return 0
+
+def git_revision():
+    try:
+        return SP.check_output(['git', 'rev-parse', '--short', 'HEAD'], cwd=SCRIPT_DIR,
+                               stderr=SP.STDOUT).decode('utf-8').strip()
+    except (OSError, SP.CalledProcessError):
+        return None
+
+def main():
+    if args.trend:
+        if not args.history:
+            print('ERROR: --trend needs --history')
+            return 1
+        return print_trend(args.trend)
+
+    if not args.binary or not os.path.isfile(args.binary):
+        print('ERROR: binary not found: %s' % args.binary)
+        return 1
+    if args.iterations < 2:
+        print('ERROR: need at least 2 iterations to compute a confidence interval')
+        return 1
+    if 'BackEnd' not in args.phases:
+        args.phases.insert(0, 'BackEnd')
+
+    corpus_dir = args.corpus_dir or tempfile.mkdtemp(prefix='jitbench')
+    if not os.path.isdir(corpus_dir):
+        os.makedirs(corpus_dir)
+
+    corpus = [entry for entry in make_corpus(args.scale)
+              if not args.tests or any(entry.name.startswith(prefix) for prefix in args.tests)]
+    for entry in corpus:
+        entry.path = os.path.join(corpus_dir, entry.name + '.js')
+        with io.open(entry.path, 'w', encoding=SOURCE_ENCODING) as out:
+            entry.build(out)
+
+    results = {
+        'version': RESULTS_FORMAT_VERSION,
+        'binary': os.path.realpath(args.binary),
+        'date': datetime.now().isoformat(),
+        'host': platform.node(),
+        'platform': platform.platform(),
+        'iterations': args.iterations,
+        'warmup': args.warmup,
+        'cpu': None,
+        'flags': ' '.join(MODES[args.mode] + args.flags.split()),
+        'tests': []
+    }
+    history = {
+        'date': results['date'],
+        'revision': git_revision(),
+        'binary': results['binary'],
+        'host': results['host'],
+        'mode': args.mode,
+        'scale': args.scale,
+        'entries': {}
+    }
+
+    print('%-24s %6s %s %10s' % ('ENTRY', 'FUNCS', ' '.join('%12.12s' % phase for phase in args.phases), 'PEAK(KB)'))
+    failed = 0
+    for entry in corpus:
+        try:
+            functions, times, peaks, wall = run_entry(entry)
+        except RuntimeError as e:
+            print('%-24s FAILED' % entry.name)
+            print(str(e))
+            failed += 1
+            continue
+
+        summaries = dict((phase, summarize(times[phase])) for phase in args.phases)
+        peak = summarize(peaks['BackEnd'])
+        print('%-24s %6d %s %10.1f' % (entry.name, functions,
+              ' '.join('%12.2f' % summaries[phase]['mean'] for phase in args.phases), peak['mean']))
+
+        for phase in args.phases:
+            results['tests'].append({
+                'suite': 'jit-time',
+                'test': '%s/%s' % (entry.name, phase),
+                'variant': args.mode,
+                'metric': 'time',
+                'biggerIsBetter': False,
+                'value': summaries[phase],
+                'wallTime': wall
+            })
+            results['tests'].append({
+                'suite': 'jit-peak',
+                'test': '%s/%s' % (entry.name, phase),
+                'variant': args.mode,
+                'metric': 'kb',
+                'biggerIsBetter': False,
+                'value': summarize(peaks[phase]),
+                'wallTime': wall
+            })
+
+        history['entries'][entry.name] = dict((phase, summaries[phase]['mean']) for phase in args.phases)
+        history['entries'][entry.name]['functions'] = functions
+        history['entries'][entry.name]['peakKB'] = peak['mean']
+
+    with open(args.output, 'w') as f:
+        json.dump(results, f, indent=2, sort_keys=True)
+    print('Results written to ' + args.output)
+
+    if args.history and history['entries']:
+        with open(args.history, 'a') as f:
+            f.write(json.dumps(history, sort_keys=True) + '\n')
+        print('History appended to ' + args.history)
+
+    if not args.corpus_dir:
+        shutil.rmtree(corpus_dir, ignore_errors=True)
+
+    if failed:
+        print('%d entr%s failed' % (failed, 'y' if failed == 1 else 'ies'))
+        return 1
+    return 0
+
+if __name__ == '__main__':
+    args = parser.parse_args()
+    sys.exit(main())
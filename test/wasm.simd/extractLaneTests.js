@@ -0,0 +1,80 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+let passed = true;
+
+function assertEquals(expected, actual, message) {
+    if (!Object.is(expected, actual)) {
+        passed = false;
+        throw `${message}: expected ${expected}, received ${actual}`;
+    }
+}
+
+// The module is encoded by hand so the test doesn't need a prebuilt .wasm
+function section(id, bytes) {
+    return [id, bytes.length, ...bytes];
+}
+function vec(items) {
+    return [items.length, ...[].concat(...items)];
+}
+function name(str) {
+    return [str.length, ...str.split("").map(c => c.charCodeAt(0))];
+}
+function body(code) {
+    return [code.length + 2, 0 /*locals*/, ...code, 0x0b];
+}
+
+const i32 = 0x7f;
+const f32 = 0x7d;
+const f64 = 0x7c;
+const simd = (op, ...imm) => [0xfd, op, ...imm];
+const getLocal = i => [0x20, i];
+
+// splat the first argument, replace one lane with the second one and read back a lane
+function splatReplaceExtract(splat, replace, replaceLane, extract, extractLane) {
+    return body([...getLocal(0), ...simd(splat), ...getLocal(1), ...simd(replace, replaceLane), ...simd(extract, extractLane)]);
+}
+
+const funcs = [
+    ["f64x2_lane0", 0, splatReplaceExtract(0x08, 0x16, 1, 0x10, 0)],
+    ["f64x2_lane1", 0, splatReplaceExtract(0x08, 0x16, 1, 0x10, 1)],
+    ["f32x4_lane0", 1, splatReplaceExtract(0x07, 0x15, 2, 0x0f, 0)],
+    ["f32x4_lane2", 1, splatReplaceExtract(0x07, 0x15, 2, 0x0f, 2)],
+    ["i8x16_lane4_s", 2, splatReplaceExtract(0x03, 0x11, 5, 0x09, 4)],
+    ["i8x16_lane5_s", 2, splatReplaceExtract(0x03, 0x11, 5, 0x09, 5)],
+    ["i8x16_lane5_u", 2, splatReplaceExtract(0x03, 0x11, 5, 0x0a, 5)],
+    ["i8x16_lane15_u", 2, splatReplaceExtract(0x03, 0x11, 15, 0x0a, 15)],
+];
+
+const buffer = new Uint8Array([
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+    ...section(1, vec([
+        [0x60, 2, f64, f64, 1, f64],
+        [0x60, 2, f32, f32, 1, f32],
+        [0x60, 2, i32, i32, 1, i32],
+    ])),
+    ...section(3, vec(funcs.map(([, type]) => [type]))),
+    ...section(7, vec(funcs.map(([exportName], i) => [...name(exportName), 0, i]))),
+    ...section(10, vec(funcs.map(([, , code]) => code))),
+]);
+
+const exports = new WebAssembly.Instance(new WebAssembly.Module(buffer)).exports;
+
+// Run enough iterations for the functions to get jitted
+for (let i = 0; i < 100; ++i) {
+    assertEquals(1.5, exports.f64x2_lane0(1.5, -2.25), "f64x2.extract_lane 0");
+    assertEquals(-2.25, exports.f64x2_lane1(1.5, -2.25), "f64x2.extract_lane 1");
+    assertEquals(-0, exports.f64x2_lane1(NaN, -0), "f64x2.extract_lane keeps the sign of zero");
+    assertEquals(0.5, exports.f32x4_lane0(0.5, 3.75), "f32x4.extract_lane 0");
+    assertEquals(3.75, exports.f32x4_lane2(0.5, 3.75), "f32x4.extract_lane 2");
+    assertEquals(0x7f, exports.i8x16_lane4_s(0x17f, 0x80), "i8x16.extract_lane_s of an untouched lane");
+    assertEquals(-128, exports.i8x16_lane5_s(0x17f, 0x80), "i8x16.extract_lane_s sign extends");
+    assertEquals(0x80, exports.i8x16_lane5_u(0x17f, 0x180), "i8x16.extract_lane_u zero extends");
+    assertEquals(0xff, exports.i8x16_lane15_u(0, -1), "i8x16.replace_lane of the last lane");
+}
+
+if (passed) {
+    print("Passed");
+}
@@ -0,0 +1,174 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+/* global assert,testRunner */ // eslint rule
+WScript.LoadScriptFile("../UnitTestFramework/UnitTestFramework.js");
+
+// The module is encoded by hand since the bulk memory operators are not supported by wabt
+function section(id, bytes) {
+  return [id, bytes.length, ...bytes];
+}
+function vec(items) {
+  return [items.length, ...[].concat(...items)];
+}
+function name(str) {
+  return [str.length, ...str.split("").map(c => c.charCodeAt(0))];
+}
+function body(code) {
+  return [code.length + 1, 0 /*locals*/, ...code];
+}
+
+const i32 = 0x7f;
+const getLocal = i => [0x20, i];
+const args3 = [...getLocal(0), ...getLocal(1), ...getLocal(2)];
+const segmentData = "hello";
+
+function buildModule({shared = false, dataCount = true} = {}) {
+  return new Uint8Array([
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+    ...section(1, vec([
+      [0x60, 3, i32, i32, i32, 0],
+      [0x60, 1, i32, 0],
+      [0x60, 1, i32, 1, i32],
+    ])),
+    ...section(3, vec([[0], [0], [0], [1], [2]])),
+    ...section(5, vec([shared ? [3, 1, 1] : [0, 1]])),
+    ...section(7, vec([
+      [...name("mem"), 2, 0],
+      [...name("copy"), 0, 0],
+      [...name("fill"), 0, 1],
+      [...name("init"), 0, 2],
+      [...name("drop"), 0, 3],
+      [...name("load"), 0, 4],
+    ])),
+    ...(dataCount ? section(12, [1]) : []),
+    ...section(10, vec([
+      body([...args3, 0xfc, 0x0a, 0, 0, 0x0b]),
+      body([...args3, 0xfc, 0x0b, 0, 0x0b]),
+      body([...args3, 0xfc, 0x08, 0, 0, 0x0b]),
+      body([0xfc, 0x09, 0, 0x0b]),
+      body([...getLocal(0), 0x2d, 0, 0, 0x0b]),
+    ])),
+    ...section(11, vec([[1, ...name(segmentData)]])),
+  ]);
+}
+
+function instantiate(options) {
+  return new WebAssembly.Instance(new WebAssembly.Module(buildModule(options))).exports;
+}
+
+function readString(load, offset, length) {
+  let str = "";
+  for (let i = 0; i < length; ++i) {
+    str += String.fromCharCode(load(offset + i));
+  }
+  return str;
+}
+
+// Run enough iterations for the functions to get jitted
+const iterations = 100;
+const pageSize = 0x10000;
+
+const tests = [
+  {
+    name: "memory.fill",
+    body() {
+      const {fill, load} = instantiate();
+      for (let i = 0; i < iterations; ++i) {
+        fill(16, i, 32);
+        assert.areEqual(0, load(15), "fill doesn't write before the range");
+        assert.areEqual(i & 0xff, load(16), "fill writes the low byte of the value");
+        assert.areEqual(i & 0xff, load(47));
+        assert.areEqual(0, load(48), "fill doesn't write after the range");
+      }
+      fill(pageSize, 1, 0);
+    }
+  },
+  {
+    name: "memory.copy with overlapping ranges",
+    body() {
+      const {copy, init, fill, load} = instantiate();
+      for (let i = 0; i < iterations; ++i) {
+        fill(0, 0, 16);
+        init(0, 0, 5);
+        copy(1, 0, 5);
+        assert.areEqual("hhello", readString(load, 0, 6), "copy forward");
+        copy(0, 1, 5);
+        assert.areEqual("helloo", readString(load, 0, 6), "copy backward");
+      }
+      copy(pageSize, pageSize, 0);
+    }
+  },
+  {
+    name: "memory.init",
+    body() {
+      const {init, load} = instantiate();
+      for (let i = 0; i < iterations; ++i) {
+        init(100, 1, 4);
+        assert.areEqual("ello", readString(load, 100, 4));
+      }
+      init(pageSize, segmentData.length, 0);
+    }
+  },
+  {
+    name: "Out of bounds operations trap without writing",
+    body() {
+      const {copy, fill, init, load} = instantiate();
+      for (let i = 0; i < iterations; ++i) {
+        assert.throws(() => fill(pageSize - 1, 1, 2), WebAssembly.RuntimeError, "fill past the end of memory");
+        assert.throws(() => fill(0, 1, -1), WebAssembly.RuntimeError, "fill count is unsigned");
+        assert.throws(() => copy(0, pageSize - 1, 2), WebAssembly.RuntimeError, "copy from past the end of memory");
+        assert.throws(() => copy(pageSize - 1, 0, 2), WebAssembly.RuntimeError, "copy to past the end of memory");
+        assert.throws(() => init(0, 1, segmentData.length), WebAssembly.RuntimeError, "init past the end of the segment");
+        assert.throws(() => init(pageSize - 1, 0, 2), WebAssembly.RuntimeError, "init past the end of memory");
+        assert.throws(() => fill(pageSize + 1, 1, 0), WebAssembly.RuntimeError, "empty fill out of bounds");
+      }
+      assert.areEqual(0, load(pageSize - 1), "trapping operations don't write");
+      assert.areEqual(0, load(0), "trapping operations don't write");
+    }
+  },
+  {
+    name: "data.drop",
+    body() {
+      const {init, drop, load} = instantiate();
+      init(0, 0, 1);
+      assert.areEqual("h".charCodeAt(0), load(0));
+      drop();
+      drop();
+      init(0, 0, 0);
+      assert.throws(() => init(0, 0, 1), WebAssembly.RuntimeError, "init from a dropped segment");
+
+      // Each instance has its own copy of the segments
+      const other = instantiate();
+      other.init(0, 0, 1);
+    }
+  },
+  {
+    name: "Shared memory",
+    body() {
+      try {
+        new WebAssembly.Memory({initial: 1, maximum: 1, shared: true});
+      } catch (e) {
+        // Threads are not enabled
+        return;
+      }
+      const {copy, fill, init, load, mem} = instantiate({shared: true});
+      init(0, 0, 5);
+      copy(5, 0, 5);
+      fill(10, 0x21, 1);
+      assert.areEqual("hellohello!", readString(load, 0, 11));
+      assert.isTrue(mem.buffer instanceof SharedArrayBuffer);
+    }
+  },
+  {
+    name: "Validation",
+    body() {
+      assert.isTrue(WebAssembly.validate(buildModule()));
+      assert.isFalse(WebAssembly.validate(buildModule({dataCount: false})), "memory.init and data.drop require the data count section");
+    }
+  },
+];
+
+testRunner.run(tests, {verbose: false});
@@ -0,0 +1,166 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+/* global assert,testRunner */ // eslint rule
+WScript.LoadScriptFile("../UnitTestFramework/UnitTestFramework.js");
+
+// Grows memories across the boundaries of their reserved address range (-WasmReserveMemory).
+// Memories with a declared maximum reserve up to it, the others start with a small reservation
+// and move to a larger one as they grow.
+
+function section(id, bytes) {
+  return [id, bytes.length, ...bytes];
+}
+function vec(items) {
+  return [items.length, ...[].concat(...items)];
+}
+function name(str) {
+  return [str.length, ...str.split("").map(c => c.charCodeAt(0))];
+}
+function body(code) {
+  return [code.length + 1, 0 /*locals*/, ...code];
+}
+
+const i32 = 0x7f;
+const getLocal = i => [0x20, i];
+const pageSize = 0x10000;
+
+function buildModule(initial, maximum) {
+  return new Uint8Array([
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+    ...section(1, vec([
+      [0x60, 1, i32, 1, i32],
+      [0x60, 2, i32, i32, 0],
+    ])),
+    ...section(3, vec([[0], [0], [1]])),
+    ...section(5, vec([maximum === undefined ? [0, initial] : [1, initial, maximum]])),
+    ...section(7, vec([
+      [...name("mem"), 2, 0],
+      [...name("grow"), 0, 0],
+      [...name("load"), 0, 1],
+      [...name("store"), 0, 2],
+    ])),
+    ...section(10, vec([
+      body([...getLocal(0), 0x40, 0, 0x0b]),
+      body([...getLocal(0), 0x2d, 0, 0, 0x0b]),
+      body([...getLocal(0), ...getLocal(1), 0x3a, 0, 0, 0x0b]),
+    ])),
+  ]);
+}
+
+function instantiate(initial, maximum) {
+  return new WebAssembly.Instance(new WebAssembly.Module(buildModule(initial, maximum))).exports;
+}
+
+// Every page gets a marker in its first and last byte
+const marker = page => (page * 7 + 1) & 0xff;
+
+function markPages(store, from, to) {
+  for (let page = from; page < to; ++page) {
+    store(page * pageSize, marker(page));
+    store((page + 1) * pageSize - 1, marker(page));
+  }
+}
+
+function checkPages(load, from, to) {
+  for (let page = from; page < to; ++page) {
+    assert.areEqual(marker(page), load(page * pageSize), `first byte of page ${page}`);
+    assert.areEqual(marker(page), load((page + 1) * pageSize - 1), `last byte of page ${page}`);
+  }
+}
+
+function checkZeroPages(load, from, to) {
+  for (let page = from; page < to; ++page) {
+    assert.areEqual(0, load(page * pageSize), `first byte of new page ${page}`);
+    assert.areEqual(0, load((page + 1) * pageSize - 1), `last byte of new page ${page}`);
+  }
+}
+
+// Grows by the given page deltas, checking that the earlier contents survive every step
+function growAndCheck({mem, grow, load, store}, deltas) {
+  let pages = mem.buffer.byteLength / pageSize;
+  markPages(store, 0, pages);
+  for (const delta of deltas) {
+    const oldBuffer = mem.buffer;
+    assert.areEqual(pages, grow(delta), `grow(${delta}) returns the old page count`);
+    assert.areEqual(0, oldBuffer.byteLength, "the old buffer is detached");
+    assert.areEqual((pages + delta) * pageSize, mem.buffer.byteLength);
+    checkPages(load, 0, pages);
+    checkZeroPages(load, pages, pages + delta);
+    markPages(store, pages, pages + delta);
+    pages += delta;
+  }
+  // Check through the buffer as well as from the module
+  const view = new Uint8Array(mem.buffer);
+  for (let page = 0; page < pages; ++page) {
+    assert.areEqual(marker(page), view[page * pageSize], `buffer view of page ${page}`);
+  }
+  return pages;
+}
+
+const smallSteps = new Array(40).fill(1);
+
+const tests = [
+  {
+    name: "Module memory without a maximum keeps its contents across reservations",
+    body() {
+      const exports = instantiate(1);
+      const pages = growAndCheck(exports, [...smallSteps, 50, 0, 3, 100]);
+      assert.areEqual(194, pages);
+    }
+  },
+  {
+    name: "Module memory without a maximum starting past the initial reservation",
+    body() {
+      const exports = instantiate(20);
+      growAndCheck(exports, [1, 20, 30]);
+    }
+  },
+  {
+    name: "Module memory with a maximum grows up to it and fails past it",
+    body() {
+      const exports = instantiate(1, 40);
+      const pages = growAndCheck(exports, [...smallSteps.slice(0, 20), 0, 19]);
+      assert.areEqual(40, pages);
+      assert.areEqual(-1, exports.grow(1), "memory.grow past the maximum");
+      assert.throws(() => exports.mem.grow(1), RangeError, "WebAssembly.Memory.prototype.grow past the maximum");
+      assert.areEqual(40 * pageSize, exports.mem.buffer.byteLength);
+      checkPages(exports.load, 0, 40);
+    }
+  },
+  {
+    name: "WebAssembly.Memory without a maximum keeps its contents across reservations",
+    body() {
+      const mem = new WebAssembly.Memory({initial: 1});
+      let pages = 1;
+      new Uint8Array(mem.buffer)[0] = 42;
+      new Uint8Array(mem.buffer)[pageSize - 1] = 1;
+      for (const delta of [15, 1, 16, 33, 70]) {
+        assert.areEqual(pages, mem.grow(delta));
+        pages += delta;
+        const view = new Uint8Array(mem.buffer);
+        assert.areEqual(pages * pageSize, view.length);
+        assert.areEqual(42, view[0]);
+        assert.areEqual(pages - delta, view[(pages - delta) * pageSize - 1]);
+        assert.areEqual(0, view[pages * pageSize - 1]);
+        view[pages * pageSize - 1] = pages;
+      }
+    }
+  },
+  {
+    name: "WebAssembly.Memory with a maximum fails past it",
+    body() {
+      const mem = new WebAssembly.Memory({initial: 0, maximum: 20});
+      assert.areEqual(0, mem.grow(19));
+      new Uint8Array(mem.buffer)[19 * pageSize - 1] = 7;
+      assert.areEqual(19, mem.grow(1));
+      assert.throws(() => mem.grow(1), RangeError);
+      assert.areEqual(20 * pageSize, mem.buffer.byteLength);
+      assert.areEqual(7, new Uint8Array(mem.buffer)[19 * pageSize - 1]);
+    }
+  },
+];
+
+testRunner.run(tests, {verbose: false});
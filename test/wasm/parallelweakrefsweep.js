@@ -0,0 +1,66 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft Corporation and contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+/* global assert,testRunner */ // eslint rule
+WScript.LoadScriptFile("../UnitTestFramework/UnitTestFramework.js");
+
+// Every view over an ArrayBuffer is tracked through a recycler weak reference, and growing a
+// WebAssembly.Memory detaches all the views that are still alive. Run with a low
+// -MinParallelWeakRefSweep so the weak reference map is swept in shards on the parallel mark threads.
+
+const pageSize = 0x10000;
+const viewCount = 20000;
+
+function createViews(buffer, keepEvery) {
+  const kept = [];
+  for (let i = 0; i < viewCount; ++i) {
+    const view = new Uint8Array(buffer, i % pageSize, 1);
+    if (i % keepEvery === 0) {
+      kept.push(view);
+    }
+  }
+  return kept;
+}
+
+const tests = [
+  {
+    name: "Views kept alive across a collection are detached, dead views are skipped",
+    body() {
+      const mem = new WebAssembly.Memory({initial: 1});
+      for (let round = 0; round < 5; ++round) {
+        const buffer = mem.buffer;
+        const kept = createViews(buffer, 10);
+        CollectGarbage();
+        for (const view of kept) {
+          assert.areEqual(1, view.length, "live view is still attached after the collection");
+        }
+        assert.areEqual(round + 1, mem.grow(0), "grow(0) returns the page count");
+        assert.areEqual(0, buffer.byteLength, "the old buffer is detached");
+        for (const view of kept) {
+          assert.areEqual(0, view.length, "live view is detached with its buffer");
+        }
+        assert.areEqual(round + 1, mem.grow(1));
+        assert.areEqual((round + 2) * pageSize, mem.buffer.byteLength);
+      }
+    }
+  },
+  {
+    name: "All views dead before the detach",
+    body() {
+      const mem = new WebAssembly.Memory({initial: 1});
+      const buffer = mem.buffer;
+      createViews(buffer, viewCount + 1);
+      CollectGarbage();
+      CollectGarbage();
+      const view = new Uint8Array(buffer);
+      view[0] = 42;
+      assert.areEqual(1, mem.grow(0));
+      assert.areEqual(0, view.length);
+      assert.areEqual(42, new Uint8Array(mem.buffer)[0]);
+    }
+  },
+];
+
+testRunner.run(tests, {verbose: false});
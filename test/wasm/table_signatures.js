@@ -101,6 +101,38 @@ const tests = signatures.map(sig => ({
   }
 }));
 
+tests.push({
+  name: "Signatures too long for a short signature match across modules",
+  body() {
+    const longParams = new Array(30).fill("i32").join(" ");
+    const {table} = new WebAssembly.Instance(new WebAssembly.Module(WebAssembly.wabt.convertWast2Wasm(`
+    (module
+      (type $long (func (param ${longParams}) (result i32)))
+      (table (export "table") 1 anyfunc)
+      (elem (i32.const 0) $f)
+      (func $f (type $long) (get_local 29))
+    )`))).exports;
+    const {callSame, callOther} = new WebAssembly.Instance(new WebAssembly.Module(WebAssembly.wabt.convertWast2Wasm(`
+    (module
+      (type $same (func (param ${longParams}) (result i32)))
+      (type $other (func (param ${longParams} i32) (result i32)))
+      (import "env" "table" (table 1 anyfunc))
+      (func (export "callSame") (result i32)
+        ${new Array(30).fill(0).map((_, i) => `(i32.const ${i})`).join(" ")}
+        (call_indirect (type $same) (i32.const 0))
+      )
+      (func (export "callOther") (result i32)
+        ${new Array(31).fill(0).map((_, i) => `(i32.const ${i})`).join(" ")}
+        (call_indirect (type $other) (i32.const 0))
+      )
+    )`)), {env: {table}}).exports;
+    for (let i = 0; i < 100; ++i) {
+      assert.areEqual(29, callSame(), "Equivalent signature from another module");
+      assert.throws(() => callOther(), WebAssembly.RuntimeError, "Different signature from another module", "Function called with invalid signature");
+    }
+  }
+});
+
 WScript.LoadScriptFile("../UnitTestFramework/yargs.js");
 const argv = yargsParse(WScript.Arguments, {
   boolean: ["verbose"],